@@ -0,0 +1,149 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Single-producer / single-consumer ring of metering records. Each record is
+// one processed block: the input of every channel followed by the output of
+// every channel, planar, as float. Unlike ScopeRing nothing is overwritten:
+// the reader needs every sample for its sums, so a block that does not fit
+// is dropped (and counted) instead. A record is always contiguous; when it
+// would run past the end of the storage the writer skips to the start.
+//==============================================================================
+class AnalysisRing
+{
+public:
+    struct Record
+    {
+        juce::int64 timelineSample{ 0 };
+        float analysisCutoff{ 0.0f }; // LF analysis cutoff for the block's filter mode
+        int level{ 0 };               // Metering::Level the block is measured at
+        int numChannels{ 0 };
+        int numSamples{ 0 };
+        juce::uint64 dataStart{ 0 };  // Sample positions in the storage, counted since prepare()
+        juce::uint64 dataEnd{ 0 };
+        bool silent{ false };         // Input and output all silence; no data stored
+    };
+
+    AnalysisRing() = default;
+
+    // Not while either side is running. Holds at least minSamples floats
+    void prepare(int minSamples)
+    {
+        capacity = static_cast<int>(juce::nextPowerOfTwo(juce::jmax(1, minSamples)));
+        storage.assign(static_cast<size_t>(capacity), 0.0f);
+        writeRecord.store(0, std::memory_order_relaxed);
+        readRecord.store(0, std::memory_order_relaxed);
+        releasedPosition.store(0, std::memory_order_relaxed);
+        writePosition = 0;
+        numDropped.store(0, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    // Writer only. Reserves a record; channel c's input goes at
+    // data + c * numSamples and its output at data + (numChannels + c) * numSamples.
+    // Returns nullptr (and counts a drop) if the reader is too far behind
+    float* beginRecord(int numChannels, int numSamples, juce::int64 timelineSample, float analysisCutoff,
+                       int level) noexcept
+    {
+        const auto size = static_cast<juce::uint64>(2 * numChannels) * static_cast<juce::uint64>(numSamples);
+        const auto index = writeRecord.load(std::memory_order_relaxed);
+
+        if (size > static_cast<juce::uint64>(capacity)
+            || index - readRecord.load(std::memory_order_acquire) >= static_cast<juce::uint64>(maxRecords))
+            return dropRecord();
+
+        auto start = writePosition;
+        const auto offset = static_cast<juce::uint64>(start & mask());
+
+        if (offset + size > static_cast<juce::uint64>(capacity))
+            start += static_cast<juce::uint64>(capacity) - offset;
+
+        if (start + size - releasedPosition.load(std::memory_order_acquire) > static_cast<juce::uint64>(capacity))
+            return dropRecord();
+
+        pending = { timelineSample, analysisCutoff, level, numChannels, numSamples, start, start + size };
+        return storage.data() + (start & mask());
+    }
+
+    // Writer only. Publishes the record from the last successful beginRecord()
+    void commitRecord() noexcept
+    {
+        const auto index = writeRecord.load(std::memory_order_relaxed);
+        records[index & recordMask] = pending;
+        writePosition = pending.dataEnd;
+        writeRecord.store(index + 1, std::memory_order_release);
+    }
+
+    // Writer only. Publishes a record for a block that is silence on both
+    // sides; it takes no space in the storage. False (and a drop) if the
+    // reader is too far behind
+    bool pushSilentRecord(int numChannels, int numSamples, juce::int64 timelineSample, float analysisCutoff,
+                          int level) noexcept
+    {
+        const auto index = writeRecord.load(std::memory_order_relaxed);
+
+        if (index - readRecord.load(std::memory_order_acquire) >= static_cast<juce::uint64>(maxRecords))
+        {
+            dropRecord();
+            return false;
+        }
+
+        records[index & recordMask] = { timelineSample, analysisCutoff, level, numChannels, numSamples,
+                                        writePosition, writePosition, true };
+        writeRecord.store(index + 1, std::memory_order_release);
+        return true;
+    }
+
+    //==============================================================================
+    // Reader only. The oldest record and its data, or nullptr if none is
+    // waiting; both stay valid until pop()
+    const float* peek(Record& record) const noexcept
+    {
+        const auto index = readRecord.load(std::memory_order_relaxed);
+
+        if (index == writeRecord.load(std::memory_order_acquire))
+            return nullptr;
+
+        record = records[index & recordMask];
+        return storage.data() + (record.dataStart & mask());
+    }
+
+    // Reader only. Hands the oldest record's space back to the writer
+    void pop(const Record& record) noexcept
+    {
+        releasedPosition.store(record.dataEnd, std::memory_order_release);
+        readRecord.store(readRecord.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Blocks dropped because the reader fell behind, since prepare()
+    juce::uint64 getNumDropped() const noexcept { return numDropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr int maxRecords = 1024;
+    static constexpr juce::uint64 recordMask = maxRecords - 1;
+
+    juce::uint64 mask() const noexcept { return static_cast<juce::uint64>(capacity - 1); }
+
+    float* dropRecord() noexcept
+    {
+        numDropped.store(numDropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    std::vector<float> storage;
+    int capacity{ 0 };
+    std::array<Record, maxRecords> records;
+
+    // Writer's
+    alignas(64) std::atomic<juce::uint64> writeRecord{ 0 };
+    juce::uint64 writePosition{ 0 };
+    Record pending;
+    std::atomic<juce::uint64> numDropped{ 0 };
+
+    // Reader's
+    alignas(64) std::atomic<juce::uint64> readRecord{ 0 };
+    std::atomic<juce::uint64> releasedPosition{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE(AnalysisRing)
+};
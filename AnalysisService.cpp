@@ -0,0 +1,99 @@
+#include "AnalysisService.h"
+
+AnalysisService::AnalysisService()
+{
+    // Metering is light next to the audio itself: a quarter of the cores,
+    // between one and four threads, whatever the number of instances
+    const int numWorkers = juce::jlimit(1, 4, juce::SystemStats::getNumCpus() / 4);
+
+    for (int i = 0; i < numWorkers; ++i)
+        workers.add(new Worker(*this, i))->startThread();
+}
+
+AnalysisService::~AnalysisService()
+{
+    // Every instance has removed itself by now
+    jassert(clients.empty());
+
+    for (auto* worker : workers)
+        worker->signalThreadShouldExit();
+
+    for (auto* worker : workers)
+        worker->stopThread(1000);
+}
+
+void AnalysisService::addClient(Client& client)
+{
+    {
+        const juce::ScopedLock sl(clientLock);
+
+        if (std::find(clients.begin(), clients.end(), &client) == clients.end())
+            clients.push_back(&client);
+    }
+
+    // Workers park while there are no clients
+    for (auto* worker : workers)
+        worker->notify();
+}
+
+void AnalysisService::removeClient(Client& client)
+{
+    {
+        const juce::ScopedLock sl(clientLock);
+        clients.erase(std::remove(clients.begin(), clients.end(), &client), clients.end());
+    }
+
+    // A worker may have claimed it just before; no new claims can start
+    while (client.busy.load(std::memory_order_acquire))
+        juce::Thread::yield();
+}
+
+bool AnalysisService::hasClients() const
+{
+    const juce::ScopedLock sl(clientLock);
+    return ! clients.empty();
+}
+
+bool AnalysisService::serviceNextClient()
+{
+    for (size_t attempt = 0;; ++attempt)
+    {
+        Client* client = nullptr;
+
+        {
+            const juce::ScopedLock sl(clientLock);
+
+            if (attempt >= clients.size())
+                return false;
+
+            // Round robin across workers, skipping a client another worker holds
+            client = clients[nextClient++ % clients.size()];
+
+            if (client->busy.exchange(true, std::memory_order_acquire))
+                continue;
+        }
+
+        const int handled = client->processPending(maxItemsPerTurn);
+        client->busy.store(false, std::memory_order_release);
+
+        if (handled > 0)
+            return true;
+    }
+}
+
+//==============================================================================
+AnalysisService::Worker::Worker(AnalysisService& owner, int index)
+    : juce::Thread("DC filter analysis " + juce::String(index + 1)), service(owner)
+{
+}
+
+void AnalysisService::Worker::run()
+{
+    while (! threadShouldExit())
+    {
+        // Poll while clients exist, otherwise sleep until one is added. A
+        // notify() that lands before the wait is kept, so none is lost
+        if (! service.serviceNextClient())
+            wait(service.hasClients() ? idleWaitMs : -1);
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Process-wide analysis pool. Every plugin instance holds it through a
+// juce::SharedResourcePointer, so it is created with the first instance and
+// destroyed with the last, and a session with hundreds of instances still
+// runs a handful of threads. Workers take registered clients in turn and
+// let each drain a bounded number of queued items per turn, so a busy
+// instance cannot starve the others. Backpressure stays with the clients:
+// their queues drop analysis work when full and the audio never waits.
+//==============================================================================
+class AnalysisService
+{
+public:
+    // Anything the pool drains
+    class Client
+    {
+    public:
+        virtual ~Client() = default;
+
+        // Worker thread, never on two workers at once for the same client.
+        // Handles at most maxItems queued items and returns how many it did
+        virtual int processPending(int maxItems) = 0;
+
+    private:
+        friend class AnalysisService;
+        std::atomic<bool> busy{ false };
+    };
+
+    AnalysisService();
+    ~AnalysisService();
+
+    // Message thread. removeClient() returns once no worker is using it
+    void addClient(Client& client);
+    void removeClient(Client& client);
+
+private:
+    class Worker : public juce::Thread
+    {
+    public:
+        Worker(AnalysisService& owner, int index);
+        void run() override;
+
+    private:
+        AnalysisService& service;
+    };
+
+    // Serves the next client with queued work; false if none had any
+    bool serviceNextClient();
+    bool hasClients() const;
+
+    // Items one client may drain per turn, and how long a worker sleeps
+    // when no client has anything queued. With no clients registered at all
+    // the workers sleep until addClient() wakes them
+    static constexpr int maxItemsPerTurn = 8;
+    static constexpr int idleWaitMs = 10;
+
+    mutable juce::CriticalSection clientLock;
+    std::vector<Client*> clients;
+    size_t nextClient{ 0 };
+
+    juce::OwnedArray<Worker> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalysisService)
+};
@@ -0,0 +1,46 @@
+// AVX2 build of the width-generic kernels. Must not include JuceHeader.h or
+// any header with inline functions shared with other TUs - see
+// DCFilterKernelsISA.h.
+
+#include "DCFilterKernelsISA.h"
+
+#if (defined (__x86_64__) || defined (__i386__)) && (defined (__clang__) || defined (__GNUC__))
+ #if defined (__clang__)
+  #pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+ #else
+  #pragma GCC push_options
+  #pragma GCC target("avx2,fma")
+ #endif
+ #define DC_KERNEL_VARIANT_TARGETED 1
+#elif defined (__AVX2__)
+ // MSVC, with /arch raised at least this far for the whole project
+ #define DC_KERNEL_VARIANT_TARGETED 1
+#else
+ // MSVC at a lower /arch: the code below would be the same generic loop at
+ // the baseline ISA, so the table says so and dispatch never picks it
+ #define DC_KERNEL_VARIANT_TARGETED 0
+#endif
+
+#define DC_KERNEL_VARIANT_NAMESPACE avx2Build
+#define DC_KERNEL_VARIANT_WIDTH 8
+#include "DCFilterKernelsWide.h"
+
+#if (defined (__x86_64__) || defined (__i386__)) && (defined (__clang__) || defined (__GNUC__))
+ #if defined (__clang__)
+  #pragma clang attribute pop
+ #else
+  #pragma GCC pop_options
+ #endif
+#endif
+
+// Outside the target region: this is called before the CPU has been checked
+namespace DCFilterKernelsISA
+{
+    const KernelTable& getAVX2Kernels()
+    {
+        static constexpr KernelTable table{ Variant::avx2, 8, &avx2Build::svfTimeParallel,
+                                            &avx2Build::levelMetrics, &avx2Build::energy,
+                                            DC_KERNEL_VARIANT_TARGETED != 0 };
+        return table;
+    }
+}
@@ -0,0 +1,61 @@
+#include <JuceHeader.h>
+#include "DCFilterKernelsISA.h"
+
+namespace DCFilterKernelsISA
+{
+    bool isSupported(Variant variant)
+    {
+        switch (variant)
+        {
+            case Variant::sse2:
+                return true;
+
+           #if JUCE_INTEL
+            case Variant::avx2:
+                return getAVX2Kernels().builtForTarget
+                    && juce::SystemStats::hasAVX2() && juce::SystemStats::hasFMA3();
+
+            case Variant::avx512:
+                return getAVX512Kernels().builtForTarget && juce::SystemStats::hasAVX512F();
+           #endif
+
+            default:
+                return false;
+        }
+    }
+
+    Variant getBestSupportedVariant()
+    {
+        // AVX-512 is only used when forced: the SVF step is bound by one
+        // broadcast per sample rather than by width, and at 16 lanes it
+        // measured slower than AVX2 on the same machine
+        if (isSupported(Variant::avx2))
+            return Variant::avx2;
+
+        return Variant::sse2;
+    }
+
+    const KernelTable& getKernels(Variant variant)
+    {
+        // Never hand out a variant the CPU cannot run
+        if (! isSupported(variant))
+            return getSSE2Kernels();
+
+        switch (variant)
+        {
+            case Variant::avx2:   return getAVX2Kernels();
+            case Variant::avx512: return getAVX512Kernels();
+            default:              return getSSE2Kernels();
+        }
+    }
+
+    const char* getVariantName(Variant variant)
+    {
+        switch (variant)
+        {
+            case Variant::avx2:   return "AVX2";
+            case Variant::avx512: return "AVX-512";
+            default:              return "SSE2";
+        }
+    }
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+//==============================================================================
+// ISA-specific builds of the hottest float kernels: the time-parallel SVF and
+// the metering sums. Each variant is the same width-generic code
+// (DCFilterKernelsWide.h) compiled in its own translation unit for a wider
+// instruction set, and the processor picks one from the CPU it runs on. The
+// 1-pole, cascade and channel-lane kernels and the double path are not in the
+// table; they stay on 128-bit juce::dsp::SIMDRegister (DCFilterKernels.h).
+//
+// Deliberately free of JUCE and standard headers: the variant TUs are
+// compiled with a raised target ISA, and any inline function they shared
+// with the rest of the plugin could be merged with an AVX copy by the linker.
+//==============================================================================
+namespace DCFilterKernelsISA
+{
+    enum class Variant
+    {
+        sse2 = 0,   // 4 floats - the baseline on every x86-64 and ARM build
+        avx2,       // 8 floats, FMA
+        avx512,     // 16 floats - built, but never picked by default (see getBestSupportedVariant)
+        numVariants
+    };
+
+    constexpr int maxWidth = 16;
+
+    // Lookahead matrices for one SVF section over width samples, in double.
+    // This is the one builder for every time-parallel SVF: the ISA kernels'
+    // SVFWideCoefficients below and DCFilterKernels::SVFBlockCoefficients
+    // are both rounded from it
+    struct SVFBlockMatrices
+    {
+        double impulse[maxWidth][maxWidth]{};  // impulse[j][k] = h[k - j] for k >= j, else 0
+        double stateResponse1[maxWidth]{};     // output for ic1eq = 1, zero input
+        double stateResponse2[maxWidth]{};     // output for ic2eq = 1, zero input
+        double inputToState1[maxWidth]{};      // contribution of x[j] to the next ic1eq
+        double inputToState2[maxWidth]{};      // contribution of x[j] to the next ic2eq
+        double stateDelta[2][2]{};             // A^width - I, applied to (ic1eq, ic2eq)
+    };
+
+    // Section coefficients as in DCFilterKernels::SVFSection
+    inline void makeSVFBlockMatrices(double k, double a1, double a2, double a3, bool highPass, int width,
+                                     SVFBlockMatrices& m)
+    {
+        // Run the recursion in double so the matrices themselves add no error
+        auto run = [=](int impulseAt, double s1, double s2, double* out, double* end)
+        {
+            for (int n = 0; n < width; ++n)
+            {
+                const double x = n == impulseAt ? 1.0 : 0.0;
+                const double v3 = x - s2;
+                const double v1 = a1 * s1 + a2 * v3;
+                const double v2 = s2 + a2 * s1 + a3 * v3;
+                s1 = 2.0 * v1 - s1;
+                s2 = 2.0 * v2 - s2;
+                out[n] = highPass ? x - k * v1 - v2 : v2;
+            }
+
+            end[0] = s1;
+            end[1] = s2;
+        };
+
+        double out[maxWidth], end[2];
+
+        m = {};
+
+        for (int j = 0; j < width; ++j)
+        {
+            run(j, 0.0, 0.0, out, end);
+
+            for (int n = j; n < width; ++n)
+                m.impulse[j][n] = out[n];
+
+            m.inputToState1[j] = end[0];
+            m.inputToState2[j] = end[1];
+        }
+
+        for (int s = 0; s < 2; ++s)
+        {
+            run(-1, s == 0 ? 1.0 : 0.0, s == 1 ? 1.0 : 0.0, out, end);
+
+            for (int n = 0; n < width; ++n)
+                (s == 0 ? m.stateResponse1 : m.stateResponse2)[n] = out[n];
+
+            // Stored as a delta from identity so its small entries keep full
+            // precision once rounded
+            m.stateDelta[0][s] = end[0] - (s == 0 ? 1.0 : 0.0);
+            m.stateDelta[1][s] = end[1] - (s == 1 ? 1.0 : 0.0);
+        }
+    }
+
+    // The same matrices as plain float arrays, so every variant can use them
+    struct SVFWideCoefficients
+    {
+        int width{ 0 };
+        float impulse[maxWidth][maxWidth]{};
+        float stateResponse1[maxWidth]{};
+        float stateResponse2[maxWidth]{};
+        float inputToState1[maxWidth]{};
+        float inputToState2[maxWidth]{};
+        float stateDelta[2][2]{};
+        float k{ 0.0f }, a1{ 1.0f }, a2{ 0.0f }, a3{ 0.0f };
+        bool highPass{ true };
+    };
+
+    inline void makeSVFWideCoefficients(double k, double a1, double a2, double a3, bool highPass, int width,
+                                        SVFWideCoefficients& coefs)
+    {
+        SVFBlockMatrices m;
+        makeSVFBlockMatrices(k, a1, a2, a3, highPass, width, m);
+
+        coefs = {};
+        coefs.width = width;
+
+        for (int j = 0; j < width; ++j)
+        {
+            for (int n = 0; n < width; ++n)
+                coefs.impulse[j][n] = static_cast<float>(m.impulse[j][n]);
+
+            coefs.stateResponse1[j] = static_cast<float>(m.stateResponse1[j]);
+            coefs.stateResponse2[j] = static_cast<float>(m.stateResponse2[j]);
+            coefs.inputToState1[j] = static_cast<float>(m.inputToState1[j]);
+            coefs.inputToState2[j] = static_cast<float>(m.inputToState2[j]);
+        }
+
+        for (int r = 0; r < 2; ++r)
+            for (int c = 0; c < 2; ++c)
+                coefs.stateDelta[r][c] = static_cast<float>(m.stateDelta[r][c]);
+
+        coefs.k = static_cast<float>(k);
+        coefs.a1 = static_cast<float>(a1);
+        coefs.a2 = static_cast<float>(a2);
+        coefs.a3 = static_cast<float>(a3);
+        coefs.highPass = highPass;
+    }
+
+    struct KernelTable
+    {
+        Variant variant;
+        int svfWidth; // Width the SVFWideCoefficients must be built for
+
+        // Single channel SVF, svfWidth samples per step, in place
+        void (*svfTimeParallel)(float* data, int numSamples, const SVFWideCoefficients& coefs,
+                                float& ic1eq, float& ic2eq);
+
+        // Adds to sum, sumSquares and raises peak
+        void (*levelMetrics)(const float* data, int numSamples, float& sum, float& peak, float& sumSquares);
+
+        // Adds the energy of data to sumSquares
+        void (*energy)(const float* data, int numSamples, float& sumSquares);
+
+        // False if the compiler could not target the variant's ISA for its
+        // TU (MSVC below the matching /arch). isSupported() then rejects it
+        bool builtForTarget;
+    };
+
+    // One per variant TU
+    const KernelTable& getSSE2Kernels();
+    const KernelTable& getAVX2Kernels();
+    const KernelTable& getAVX512Kernels();
+
+    // Dispatch (DCFilterKernelsISA.cpp)
+    bool isSupported(Variant variant);
+    Variant getBestSupportedVariant();
+    const KernelTable& getKernels(Variant variant);
+    const char* getVariantName(Variant variant);
+}
@@ -0,0 +1,18 @@
+// Baseline build of the width-generic kernels: SSE2 on x86-64, NEON on ARM.
+// Kept JUCE-free like the other variants - see DCFilterKernelsISA.h.
+
+#include "DCFilterKernelsISA.h"
+
+#define DC_KERNEL_VARIANT_NAMESPACE sse2Build
+#define DC_KERNEL_VARIANT_WIDTH 4
+#include "DCFilterKernelsWide.h"
+
+namespace DCFilterKernelsISA
+{
+    const KernelTable& getSSE2Kernels()
+    {
+        static constexpr KernelTable table{ Variant::sse2, 4, &sse2Build::svfTimeParallel,
+                                            &sse2Build::levelMetrics, &sse2Build::energy, true };
+        return table;
+    }
+}
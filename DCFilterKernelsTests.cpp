@@ -0,0 +1,106 @@
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+#if JUCE_UNIT_TESTS
+
+//==============================================================================
+// Every ISA variant this CPU can run must agree with the scalar kernels. Each
+// one is forced through the processor, as a host or benchmark would, so the
+// test also covers the selection reaching prepareToPlay.
+//==============================================================================
+class DCFilterKernelVariantTests : public juce::UnitTest
+{
+public:
+    DCFilterKernelVariantTests() : juce::UnitTest("DC filter kernel variants", "DCHighpass") {}
+
+    void runTest() override
+    {
+        for (int v = 0; v < static_cast<int>(DCFilterKernelsISA::Variant::numVariants); ++v)
+        {
+            const auto variant = static_cast<DCFilterKernelsISA::Variant>(v);
+
+            if (! DCFilterKernelsISA::isSupported(variant))
+                continue;
+
+            beginTest(DCFilterKernelsISA::getVariantName(variant));
+
+            NewProjectAudioProcessor processor;
+            processor.setKernelVariant(variant);
+            processor.prepareToPlay(48000.0, 512);
+
+            expect(processor.getKernelVariant() == variant);
+            expectLessThan(measureErrorAgainstScalar(variant), 1.0e-4f);
+
+            processor.releaseResources();
+        }
+    }
+
+private:
+    // Runs a variant against the scalar reference on a fixed test signal and
+    // returns the largest difference
+    static float measureErrorAgainstScalar(DCFilterKernelsISA::Variant variant)
+    {
+        const auto& kernels = DCFilterKernelsISA::getKernels(variant);
+
+        // DC offset, a 50 Hz tone and noise; an odd length exercises the tails
+        constexpr int numSamples = 1021;
+        std::vector<float> input(numSamples);
+        juce::Random random(0x0dc);
+
+        for (int i = 0; i < numSamples; ++i)
+            input[i] = 0.25f + 0.5f * std::sin(0.0065f * static_cast<float>(i)) + 0.1f * (random.nextFloat() - 0.5f);
+
+        float maxError = 0.0f;
+
+        for (auto output : { DCFilterKernels::SVFOutput::highPass, DCFilterKernels::SVFOutput::lowPass })
+        {
+            const auto section = DCFilterKernels::makeSVFSection<float>(48000.0, 20.0);
+            DCFilterKernelsISA::SVFWideCoefficients wide;
+            DCFilterKernelsISA::makeSVFWideCoefficients(section.k, section.a1, section.a2, section.a3,
+                                                        output == DCFilterKernels::SVFOutput::highPass,
+                                                        kernels.svfWidth, wide);
+
+            auto reference = input;
+            DCFilterKernels::SVFState<float> referenceState;
+
+            for (auto& x : reference)
+                x = DCFilterKernels::processSVFSample(x, section, referenceState, output);
+
+            // Uneven calls, so state carries across partial steps too
+            auto result = input;
+            float ic1eq = 0.0f, ic2eq = 0.0f;
+
+            for (int start = 0, length = 37; start < numSamples; start += length, length = length * 2 + 1)
+                kernels.svfTimeParallel(result.data() + start, juce::jmin(length, numSamples - start), wide,
+                                        ic1eq, ic2eq);
+
+            for (int i = 0; i < numSamples; ++i)
+                maxError = juce::jmax(maxError, std::abs(result[i] - reference[i]));
+        }
+
+        float sum = 0.0f, peak = 0.0f, sumSquares = 0.0f, energy = 0.0f;
+        kernels.levelMetrics(input.data(), numSamples, sum, peak, sumSquares);
+        kernels.energy(input.data(), numSamples, energy);
+
+        double referenceSum = 0.0, referenceSquares = 0.0;
+        float referencePeak = 0.0f;
+
+        for (auto x : input)
+        {
+            referenceSum += x;
+            referenceSquares += static_cast<double>(x) * x;
+            referencePeak = juce::jmax(referencePeak, std::abs(x));
+        }
+
+        // Sums are compared relative to their size: only the summation order differs
+        maxError = juce::jmax(maxError, static_cast<float>(std::abs(sum - referenceSum) / referenceSum),
+                              static_cast<float>(std::abs(sumSquares - referenceSquares) / referenceSquares),
+                              static_cast<float>(std::abs(energy - referenceSquares) / referenceSquares));
+
+        return peak == referencePeak ? maxError : std::numeric_limits<float>::max();
+    }
+};
+
+static DCFilterKernelVariantTests dcFilterKernelVariantTests;
+
+#endif
@@ -0,0 +1,172 @@
+// No include guard: every variant TU includes this once, inside its own
+// namespace, with its own target ISA. See DCFilterKernelsISA.h.
+//
+// Width-generic kernels written on a Lanes type of DC_KERNEL_VARIANT_WIDTH
+// floats. With GCC and Clang that is a native vector of the TU's target
+// width; elsewhere it is a plain array the optimiser can vectorize.
+
+#if ! defined (DC_KERNEL_VARIANT_NAMESPACE) || ! defined (DC_KERNEL_VARIANT_WIDTH)
+ #error "Define DC_KERNEL_VARIANT_NAMESPACE and DC_KERNEL_VARIANT_WIDTH before including DCFilterKernelsWide.h"
+#endif
+
+namespace DCFilterKernelsISA
+{
+namespace DC_KERNEL_VARIANT_NAMESPACE
+{
+    constexpr int width = DC_KERNEL_VARIANT_WIDTH;
+
+   #if defined (__GNUC__)
+    typedef float Lanes __attribute__((vector_size(width * sizeof(float))));
+
+    inline Lanes broadcast(float x)               { return Lanes{} + x; }
+    inline Lanes maxLanes(Lanes a, Lanes b)       { return a > b ? a : b; }
+    inline Lanes absLanes(Lanes a)                { return a < 0.0f ? -a : a; }
+
+    inline Lanes load(const float* data)
+    {
+        Lanes v;
+        __builtin_memcpy(&v, data, sizeof(v));
+        return v;
+    }
+
+    inline void store(float* data, Lanes v)
+    {
+        __builtin_memcpy(data, &v, sizeof(v));
+    }
+   #else
+    struct Lanes
+    {
+        float v[width];
+
+        float operator[](int n) const                { return v[n]; }
+        Lanes& operator+=(Lanes b)                   { for (int n = 0; n < width; ++n) v[n] += b.v[n]; return *this; }
+        Lanes operator+(Lanes b) const               { Lanes r = *this; return r += b; }
+        Lanes operator*(Lanes b) const               { Lanes r; for (int n = 0; n < width; ++n) r.v[n] = v[n] * b.v[n]; return r; }
+    };
+
+    inline Lanes broadcast(float x)               { Lanes r; for (int n = 0; n < width; ++n) r.v[n] = x; return r; }
+    inline Lanes maxLanes(Lanes a, Lanes b)       { for (int n = 0; n < width; ++n) a.v[n] = a.v[n] > b.v[n] ? a.v[n] : b.v[n]; return a; }
+    inline Lanes absLanes(Lanes a)                { for (int n = 0; n < width; ++n) a.v[n] = a.v[n] < 0.0f ? -a.v[n] : a.v[n]; return a; }
+    inline Lanes load(const float* data)          { Lanes r; for (int n = 0; n < width; ++n) r.v[n] = data[n]; return r; }
+    inline void store(float* data, Lanes v)       { for (int n = 0; n < width; ++n) data[n] = v.v[n]; }
+   #endif
+
+    // Pairwise, so the reduction is log2(width) dependent adds rather than width
+    inline float sumLanes(Lanes v)
+    {
+        float t[width];
+        store(t, v);
+
+        for (int half = width / 2; half > 0; half /= 2)
+            for (int n = 0; n < half; ++n)
+                t[n] += t[n + half];
+
+        return t[0];
+    }
+
+    inline float maxOfLanes(Lanes v, float initial)
+    {
+        for (int n = 0; n < width; ++n)
+            initial = initial > v[n] ? initial : v[n];
+
+        return initial;
+    }
+
+    void svfTimeParallel(float* data, int numSamples, const SVFWideCoefficients& c, float& ic1eq, float& ic2eq)
+    {
+        Lanes impulse[width];
+
+        for (int j = 0; j < width; ++j)
+            impulse[j] = load(c.impulse[j]);
+
+        const Lanes stateResponse1 = load(c.stateResponse1);
+        const Lanes stateResponse2 = load(c.stateResponse2);
+        const Lanes inputToState1 = load(c.inputToState1);
+        const Lanes inputToState2 = load(c.inputToState2);
+
+        float s1 = ic1eq, s2 = ic2eq;
+        int i = 0;
+
+        for (; i + width <= numSamples; i += width)
+        {
+            const Lanes x = load(data + i);
+
+            // Outputs: state response plus each input's impulse response
+            Lanes y = stateResponse1 * broadcast(s1) + stateResponse2 * broadcast(s2);
+
+            for (int j = 0; j < width; ++j)
+                y += impulse[j] * broadcast(x[j]);
+
+            store(data + i, y);
+
+            // State: one step of width samples
+            const float delta1 = c.stateDelta[0][0] * s1 + c.stateDelta[0][1] * s2 + sumLanes(inputToState1 * x);
+            const float delta2 = c.stateDelta[1][0] * s1 + c.stateDelta[1][1] * s2 + sumLanes(inputToState2 * x);
+            s1 += delta1;
+            s2 += delta2;
+        }
+
+        for (; i < numSamples; ++i)
+        {
+            const float x = data[i];
+            const float v3 = x - s2;
+            const float v1 = c.a1 * s1 + c.a2 * v3;
+            const float v2 = s2 + c.a2 * s1 + c.a3 * v3;
+            s1 = 2.0f * v1 - s1;
+            s2 = 2.0f * v2 - s2;
+            data[i] = c.highPass ? x - c.k * v1 - v2 : v2;
+        }
+
+        ic1eq = s1;
+        ic2eq = s2;
+    }
+
+    void levelMetrics(const float* data, int numSamples, float& sum, float& peak, float& sumSquares)
+    {
+        Lanes sums = broadcast(0.0f);
+        Lanes peaks = broadcast(0.0f);
+        Lanes squares = broadcast(0.0f);
+        int i = 0;
+
+        for (; i + width <= numSamples; i += width)
+        {
+            const Lanes x = load(data + i);
+            sums += x;
+            squares += x * x;
+            peaks = maxLanes(peaks, absLanes(x));
+        }
+
+        float peakOut = maxOfLanes(peaks, peak);
+        sum += sumLanes(sums);
+        sumSquares += sumLanes(squares);
+
+        for (; i < numSamples; ++i)
+        {
+            const float x = data[i];
+            const float magnitude = x < 0.0f ? -x : x;
+            sum += x;
+            sumSquares += x * x;
+            peakOut = peakOut > magnitude ? peakOut : magnitude;
+        }
+
+        peak = peakOut;
+    }
+
+    void energy(const float* data, int numSamples, float& sumSquares)
+    {
+        Lanes squares = broadcast(0.0f);
+        int i = 0;
+
+        for (; i + width <= numSamples; i += width)
+        {
+            const Lanes x = load(data + i);
+            squares += x * x;
+        }
+
+        sumSquares += sumLanes(squares);
+
+        for (; i < numSamples; ++i)
+            sumSquares += data[i] * data[i];
+    }
+}
+}
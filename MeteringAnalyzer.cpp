@@ -0,0 +1,224 @@
+#include "MeteringAnalyzer.h"
+
+Metering::MeterValues Metering::MetricsSnapshot::getWorstCase() const
+{
+    auto largestOffset = [](float a, float b) { return std::abs(b) > std::abs(a) ? b : a; };
+
+    MeterValues worst;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const auto& values = channels[static_cast<size_t>(ch)];
+        worst.dcOffsetPre = largestOffset(worst.dcOffsetPre, values.dcOffsetPre);
+        worst.rmsPre = juce::jmax(worst.rmsPre, values.rmsPre);
+        worst.peakPre = juce::jmax(worst.peakPre, values.peakPre);
+        worst.lowFreqPre = juce::jmax(worst.lowFreqPre, values.lowFreqPre);
+        worst.dcOffsetPost = largestOffset(worst.dcOffsetPost, values.dcOffsetPost);
+        worst.rmsPost = juce::jmax(worst.rmsPost, values.rmsPost);
+        worst.peakPost = juce::jmax(worst.peakPost, values.peakPost);
+        worst.lowFreqPost = juce::jmax(worst.lowFreqPost, values.lowFreqPost);
+    }
+
+    return worst;
+}
+
+//==============================================================================
+MeteringAnalyzer::MeteringAnalyzer()
+{
+}
+
+MeteringAnalyzer::~MeteringAnalyzer()
+{
+    release();
+}
+
+void MeteringAnalyzer::prepare(double newSampleRate, int numChannels, int maxBlockSize,
+                             const DCFilterKernelsISA::KernelTable& newKernels)
+{
+    release();
+
+    kernels = &newKernels;
+    sampleRate = newSampleRate;
+    decimationStages = juce::jlimit(0, DCFilterKernels::maxCICStages,
+                                    juce::roundToInt(std::log2(sampleRate / lowFreqAnalysisRate)));
+    analysisCutoff = 0.0f;
+
+    // A quarter of a second of input and output for every channel, and at
+    // least a few blocks, before the audio thread has to drop one
+    const auto samplesPerChannel = juce::jmax(static_cast<int>(sampleRate * ringSeconds), 4 * maxBlockSize);
+    ring.prepare(2 * numChannels * samplesPerChannel);
+
+    channels.assign(static_cast<size_t>(numChannels), {});
+    scratch.assign(static_cast<size_t>(juce::jmax(1, maxBlockSize)), 0.0f);
+    level = Metering::LEVEL_OFF;
+    resetAnalysis();
+
+    // Publish the cleared values; no worker serves this analyzer yet, so
+    // this is still the only writer
+    auto& snapshot = snapshots.getWriteBuffer();
+    snapshot = {};
+    snapshot.updateIndex = ++updateIndex;
+    snapshots.publish();
+
+    service->addClient(*this);
+    registered = true;
+}
+
+void MeteringAnalyzer::release()
+{
+    if (registered)
+        service->removeClient(*this);
+
+    registered = false;
+}
+
+int MeteringAnalyzer::processPending(int maxItems)
+{
+    int handled = 0;
+    AnalysisRing::Record record;
+
+    for (; handled < maxItems; ++handled)
+    {
+        const auto* data = ring.peek(record);
+
+        if (data == nullptr)
+            break;
+
+        processRecord(record, data);
+        ring.pop(record);
+    }
+
+    return handled;
+}
+
+void MeteringAnalyzer::setAnalysisCutoff(float cutoff)
+{
+    if (cutoff == analysisCutoff)
+        return;
+
+    analysisCutoff = cutoff;
+    const auto section = DCFilterKernels::makeSVFSection<float>(sampleRate / (1 << decimationStages), cutoff);
+    DCFilterKernelsISA::makeSVFWideCoefficients(section.k, section.a1, section.a2, section.a3, false,
+                                                kernels->svfWidth, analysisWide);
+}
+
+void MeteringAnalyzer::resetAnalysis()
+{
+    std::fill(channels.begin(), channels.end(), ChannelState{});
+    currentMeters.fill({});
+    rmsSampleCount = 0;
+    lowFreqSampleCount = 0;
+    decimationPhase = 0;
+}
+
+void MeteringAnalyzer::measure(const float* data, int numSamples, bool full, SignalState& signal,
+                               float& dcOffset, float& peak)
+{
+    float sum = 0.0f, sumSquares = 0.0f, lowFreqSumSquares = 0.0f;
+    peak = 0.0f;
+
+    kernels->levelMetrics(data, numSamples, sum, peak, sumSquares);
+    dcOffset = sum / static_cast<float>(numSamples);
+
+    if (! full)
+        return;
+
+    // Energy below the analysis cutoff, at the analysis rate, in pieces of
+    // the scratch buffer
+    const int phaseMask = (1 << decimationStages) - 1;
+
+    for (int start = 0; start < numSamples;)
+    {
+        const int length = juce::jmin(numSamples - start, static_cast<int>(scratch.size()));
+        std::copy(data + start, data + start + length, scratch.data());
+
+        const int numDecimated = DCFilterKernels::processCICDecimator(scratch.data(), length, decimationStages,
+                                                                      (decimationPhase + start) & phaseMask,
+                                                                      signal.decimator);
+
+        kernels->svfTimeParallel(scratch.data(), numDecimated, analysisWide, signal.ic1eq, signal.ic2eq);
+        kernels->energy(scratch.data(), numDecimated, lowFreqSumSquares);
+        start += length;
+    }
+
+    signal.sumSquares += sumSquares;
+    signal.lowFreqSumSquares += lowFreqSumSquares;
+}
+
+void MeteringAnalyzer::processRecord(const AnalysisRing::Record& record, const float* data)
+{
+    const int numSamples = record.numSamples;
+    const int numChannels = juce::jmin(record.numChannels, static_cast<int>(channels.size()));
+
+    // Sums and filter state from another level do not carry over
+    if (record.level != level)
+    {
+        level = record.level;
+        resetAnalysis();
+    }
+
+    if (level != Metering::LEVEL_OFF && numSamples > 0)
+    {
+        const bool full = level == Metering::LEVEL_FULL;
+
+        if (full)
+        {
+            setAnalysisCutoff(record.analysisCutoff);
+            rmsSampleCount += numSamples;
+            lowFreqSampleCount += (decimationPhase + numSamples) >> decimationStages;
+        }
+
+        // RMS and low frequency update every rmsUpdateInterval samples, which
+        // is at least two analysis-rate samples
+        bool updateRMS = full && rmsSampleCount >= rmsUpdateInterval;
+        const auto lowFreqCount = static_cast<float>(juce::jmax(1, lowFreqSampleCount));
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& channel = channels[static_cast<size_t>(ch)];
+            auto& meters = currentMeters[static_cast<size_t>(ch)];
+            const auto* input = data + static_cast<size_t>(ch) * static_cast<size_t>(numSamples);
+            const auto* output = data + static_cast<size_t>(record.numChannels + ch) * static_cast<size_t>(numSamples);
+
+            // DC offset and peak are per block
+            if (record.silent)
+            {
+                // Zeros on both sides: the sums stay put, the LF decimator
+                // and low-pass rest
+                meters.dcOffsetPre = meters.peakPre = meters.dcOffsetPost = meters.peakPost = 0.0f;
+                channel.pre.ic1eq = channel.pre.ic2eq = channel.post.ic1eq = channel.post.ic2eq = 0.0f;
+                channel.pre.decimator = channel.post.decimator = {};
+            }
+            else
+            {
+                measure(input, numSamples, full, channel.pre, meters.dcOffsetPre, meters.peakPre);
+                measure(output, numSamples, full, channel.post, meters.dcOffsetPost, meters.peakPost);
+            }
+
+            if (updateRMS)
+            {
+                meters.rmsPre = std::sqrt(channel.pre.sumSquares / rmsSampleCount);
+                meters.lowFreqPre = std::sqrt(channel.pre.lowFreqSumSquares / lowFreqCount);
+                meters.rmsPost = std::sqrt(channel.post.sumSquares / rmsSampleCount);
+                meters.lowFreqPost = std::sqrt(channel.post.lowFreqSumSquares / lowFreqCount);
+                channel.pre.sumSquares = channel.pre.lowFreqSumSquares = 0.0f;
+                channel.post.sumSquares = channel.post.lowFreqSumSquares = 0.0f;
+            }
+        }
+
+        if (full)
+            decimationPhase = (decimationPhase + numSamples) & ((1 << decimationStages) - 1);
+
+        if (updateRMS)
+            rmsSampleCount = lowFreqSampleCount = 0;
+    }
+
+    // One publication for all channels
+    auto& snapshot = snapshots.getWriteBuffer();
+    snapshot.updateIndex = ++updateIndex;
+    snapshot.timelineSample = record.timelineSample;
+    snapshot.numChannels = numChannels;
+    snapshot.level = level;
+    std::copy(currentMeters.begin(), currentMeters.begin() + numChannels, snapshot.channels.begin());
+    snapshots.publish();
+}
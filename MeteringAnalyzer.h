@@ -0,0 +1,135 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "DCFilterKernels.h"
+#include "DCFilterKernelsISA.h"
+#include "TripleBuffer.h"
+#include "AnalysisRing.h"
+#include "AnalysisService.h"
+
+namespace Metering
+{
+    // Widest bus accepted (3rd-order ambisonics is 16, 7.1.4 is 12)
+    constexpr int maxChannels = 64;
+
+    // What gets measured, cheapest first (the "meteringLevel" parameter)
+    enum Level {
+        LEVEL_OFF = 0,      // Nothing copied or analysed
+        LEVEL_PEAK_DC = 1,  // DC offset and peak only
+        LEVEL_FULL = 2,     // Also RMS and the LF low-pass
+        NUM_LEVELS
+    };
+
+    // Metrics for one channel; every channel of the bus is metered
+    struct MeterValues
+    {
+        // Pre-filter metrics (input signal)
+        float dcOffsetPre{ 0.0f }, rmsPre{ 0.0f }, peakPre{ 0.0f }, lowFreqPre{ 0.0f };
+
+        // Post-filter metrics (output signal - what you actually hear)
+        float dcOffsetPost{ 0.0f }, rmsPost{ 0.0f }, peakPost{ 0.0f }, lowFreqPost{ 0.0f };
+    };
+
+    // Every channel's metrics from one metering update, published as a unit
+    struct MetricsSnapshot
+    {
+        juce::uint64 updateIndex{ 0 };   // Counts publications; never repeats, so readers can skip unchanged ones
+        juce::int64 timelineSample{ 0 }; // Start of the block the update closed
+        int numChannels{ 0 };
+        int level{ LEVEL_OFF };          // Values above this level's are zero
+        std::array<MeterValues, maxChannels> channels;
+
+        // Worst value of each metric across all channels (DC keeps its sign)
+        MeterValues getWorstCase() const;
+    };
+}
+
+//==============================================================================
+// Metering off the audio thread. The audio thread only copies each block's
+// input and output into the analysis ring; the shared AnalysisService
+// drains it on one of its workers, which runs the LF low-pass and the level
+// kernels and publishes the snapshot. The LF energy is measured on a
+// CIC-decimated copy of the signal (see lowFreqAnalysisRate). Only one
+// worker at a time serves an analyzer, so while registered it is the
+// snapshot's only writer. Each record carries its metering level; a change
+// of level starts the sums and filters afresh, and an empty LEVEL_OFF
+// record clears the meters. Silent records stand for a block of zeros
+// without carrying it.
+//==============================================================================
+class MeteringAnalyzer : private AnalysisService::Client
+{
+public:
+    MeteringAnalyzer();
+    ~MeteringAnalyzer() override;
+
+    // Message thread, with the audio thread stopped. Sizes the ring and the
+    // analysis state, publishes cleared meters and registers with the service
+    void prepare(double sampleRate, int numChannels, int maxBlockSize, const DCFilterKernelsISA::KernelTable& kernels);
+
+    // Message thread. Leaves the service; prepare() joins it again
+    void release();
+
+    // Audio thread only
+    AnalysisRing& getRing() noexcept { return ring; }
+
+    // Message thread only. Latest snapshot, read in one consistent copy; the
+    // reference stays valid until the next call
+    const Metering::MetricsSnapshot& getSnapshot() { return snapshots.read(); }
+
+private:
+    int processPending(int maxItems) override;
+    void processRecord(const AnalysisRing::Record& record, const float* data);
+    void setAnalysisCutoff(float cutoff);
+    void resetAnalysis();
+
+    // LF analysis decimator, low-pass and sums for one signal (input or
+    // output) of one channel. The squares accumulate until the next RMS
+    // update; the LF ones are at the analysis rate
+    struct SignalState
+    {
+        DCFilterKernels::CICDecimatorState<float> decimator;
+        float ic1eq{ 0.0f }, ic2eq{ 0.0f };
+        float sumSquares{ 0.0f };
+        float lowFreqSumSquares{ 0.0f };
+    };
+
+    struct ChannelState
+    {
+        SignalState pre, post;
+    };
+
+    void measure(const float* data, int numSamples, bool full, SignalState& signal, float& dcOffset, float& peak);
+
+    // Audio the ring holds while the service is busy with other instances
+    static constexpr double ringSeconds = 0.25;
+
+    // The LF energy lies far below the host's Nyquist, so it is measured
+    // after decimating by the power of two that brings the rate closest to
+    // this: 32x at 44.1 and 48 kHz, 128x at 192 kHz. Its cost per second of
+    // audio then hardly depends on the host rate
+    static constexpr double lowFreqAnalysisRate = 1500.0;
+
+    juce::SharedResourcePointer<AnalysisService> service;
+    bool registered{ false };
+
+    AnalysisRing ring;
+    TripleBuffer<Metering::MetricsSnapshot> snapshots;
+
+    // Service worker only while registered
+    const DCFilterKernelsISA::KernelTable* kernels{ nullptr };
+    double sampleRate{ 44100.0 };
+    int decimationStages{ 0 };          // Decimation by 2^decimationStages
+    int decimationPhase{ 0 };           // Samples taken so far, modulo the factor
+    float analysisCutoff{ 0.0f };
+    int level{ Metering::LEVEL_OFF };
+    DCFilterKernelsISA::SVFWideCoefficients analysisWide;
+    std::vector<ChannelState> channels;
+    std::vector<float> scratch;
+    std::array<Metering::MeterValues, Metering::maxChannels> currentMeters;
+    int rmsSampleCount{ 0 };
+    int lowFreqSampleCount{ 0 };        // Analysis-rate samples in the same span
+    static constexpr int rmsUpdateInterval = 256; // Update RMS every N samples
+    juce::uint64 updateIndex{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MeteringAnalyzer)
+};
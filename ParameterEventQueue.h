@@ -0,0 +1,84 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Bounded lock-free queue of parameter changes. The APVTS listener can be
+// called from the message thread, the host's automation thread or the audio
+// thread, so pushes may race each other; only the audio thread pops.
+// Each slot carries a sequence number (bounded MPMC ring, used here as MPSC),
+// so neither side ever blocks or allocates.
+//==============================================================================
+template <typename EventType, int capacity>
+class ParameterEventQueue
+{
+public:
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+
+    ParameterEventQueue()
+    {
+        for (int i = 0; i < capacity; ++i)
+            slots[i].sequence.store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+    }
+
+    // Any thread. Returns false (and drops the event) if the queue is full
+    bool push(const EventType& event) noexcept
+    {
+        auto position = writePosition.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            auto& slot = slots[position & mask];
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<int32_t>(sequence - position);
+
+            if (difference == 0)
+            {
+                if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.event = event;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = writePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Audio thread only
+    bool pop(EventType& event) noexcept
+    {
+        auto& slot = slots[readPosition & mask];
+        auto sequence = slot.sequence.load(std::memory_order_acquire);
+
+        if (sequence != readPosition + 1)
+            return false; // Empty, or a push has claimed the slot but not finished
+
+        event = slot.event;
+        slot.sequence.store(readPosition + capacity, std::memory_order_release);
+        ++readPosition;
+        return true;
+    }
+
+private:
+    static constexpr uint32_t mask = static_cast<uint32_t>(capacity - 1);
+
+    struct Slot
+    {
+        std::atomic<uint32_t> sequence{ 0 };
+        EventType event{};
+    };
+
+    Slot slots[capacity];
+    alignas(64) std::atomic<uint32_t> writePosition{ 0 };
+    alignas(64) uint32_t readPosition{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE(ParameterEventQueue)
+};
@@ -6,26 +6,77 @@
 //==============================================================================
 
 VisualizerComponent::VisualizerComponent(NewProjectAudioProcessor& p)
-    : audioProcessor(p)
+    : audioProcessor(p), cutoffParameter(p.apvts.getRawParameterValue("cutoff"))
 {
+    // --- Time window selector ---
+    static constexpr double windowChoices[] = { 0.02, 0.1, 0.5, 2.0, 10.0 };
+    addChildComponent(windowComboBox);
+
+    for (int i = 0; i < juce::numElementsInArray(windowChoices); ++i)
+    {
+        const auto seconds = windowChoices[i];
+        windowComboBox.addItem(seconds < 1.0 ? juce::String(juce::roundToInt(seconds * 1000.0)) + " ms"
+                                             : juce::String(juce::roundToInt(seconds)) + " s", i + 1);
+    }
+
+    windowComboBox.setSelectedId(1, juce::dontSendNotification);
+    windowComboBox.onChange = [this]() {
+        windowSeconds = windowChoices[juce::jmax(0, windowComboBox.getSelectedId() - 1)];
+        repaint();
+        };
+
+    // --- Display mode selector ---
+    addChildComponent(displayModeComboBox);
+    displayModeComboBox.addItem("Trace", DISPLAY_TRACE);
+    displayModeComboBox.addItem("Scroll", DISPLAY_SCROLL);
+    displayModeComboBox.addItem("Phosphor", DISPLAY_PHOSPHOR);
+    displayModeComboBox.setSelectedId(DISPLAY_TRACE, juce::dontSendNotification);
+    displayModeComboBox.onChange = [this]() {
+        displayMode = displayModeComboBox.getSelectedId();
+
+        // Only the current mode's buffers are kept
+        traceImage = juce::Image();
+        phosphorImage = juce::Image();
+        phosphorIntensity = {};
+        traceSamplesPerColumn = 0;
+        repaint();
+        };
+
+    buildPhosphorLut();
     setVisualizerActive(false);
 }
 
 VisualizerComponent::~VisualizerComponent()
 {
-    stopTimer();
+    // Without an editor nobody reads the scope; the parameter keeps the
+    // setting for the next one
+    audioProcessor.setVisualizerState(false);
 }
 
 void VisualizerComponent::setVisualizerActive(bool active)
 {
     visualizerEnabled = active;
     audioProcessor.setVisualizerState(active);
+    windowComboBox.setVisible(active);
+    displayModeComboBox.setVisible(active);
+    traceSamplesPerColumn = 0; // The ring has moved on while hidden
 
-    if (active)
-        startTimerHz(30); // Human-scale refresh rate (30 fps)
-    else
-        stopTimer(); // Complete CPU shutdown when disabled
+    repaint();
+}
 
+void VisualizerComponent::refreshIfNewData(double nowSeconds)
+{
+    // Nothing at all while disabled; no frame while the ring stands still
+    if (! visualizerEnabled || nowSeconds - lastFrameTime < frameInterval)
+        return;
+
+    auto position = audioProcessor.getScopeRing().getWritePosition();
+
+    if (position == lastFramePosition)
+        return;
+
+    lastFramePosition = position;
+    lastFrameTime = nowSeconds;
     repaint();
 }
 
@@ -100,42 +151,33 @@ void VisualizerComponent::paint(juce::Graphics& g)
     g.drawImageAt(backgroundGrid, 0, 0);
 
     // Get POST-filter metrics (what you're actually hearing)
-    float dcOffsetPost = audioProcessor.getDCOffsetPost();
-    float lowFreqPost = audioProcessor.getLowFreqPost();
-
-    // Draw waveform (POST-filter)
-    g.setColour(juce::Colours::cyan.withAlpha(0.9f));
-    juce::Path waveformPath;
-
-    auto currentWriteIndex = audioProcessor.fifoWriteIndex.load(std::memory_order_relaxed);
-
-    // Calculate the oldest sample index correctly
-    int startIndex = currentWriteIndex - audioProcessor.fifoSize;
-    if (startIndex < 0)
-        startIndex += audioProcessor.fifoSize;
-
-    startIndex = startIndex % audioProcessor.fifoSize;
+    const auto& snapshot = audioProcessor.getMetricsSnapshot();
+    const auto& meters = snapshot.channels[0]; // The waveform is channel 0
+    float dcOffsetPost = meters.dcOffsetPost;
+    float lowFreqPost = meters.lowFreqPost;
 
     // Calculate drawing parameters
-    float xIncrement = (float)getWidth() / (float)(audioProcessor.fifoSize - 1);
     float yScale = (float)getHeight() / 2.0f;
     float yOffset = (float)getHeight() / 2.0f;
 
-    // Start the path
-    float firstSample = audioProcessor.getNextSampleForVisualizer(startIndex);
-    float y = yOffset - (firstSample * yScale);
-    waveformPath.startNewSubPath(0.0f, y);
+    // Draw waveform (POST-filter): one vertical span per pixel column
+    const int numColumns = static_cast<int>(columns.size());
 
-    // Draw remaining samples
-    for (int i = 1; i < audioProcessor.fifoSize; ++i)
+    if (displayMode == DISPLAY_SCROLL)
     {
-        float sample = audioProcessor.getNextSampleForVisualizer((startIndex + i) % audioProcessor.fifoSize);
-        y = yOffset - (sample * yScale);
-        float x = i * xIncrement;
-        waveformPath.lineTo(x, y);
+        renderScrollingTrace();
+        g.drawImageAt(traceImage, 0, 0);
+    }
+    else if (displayMode == DISPLAY_PHOSPHOR)
+    {
+        renderPhosphor();
+        g.drawImageAt(phosphorImage, 0, 0);
+    }
+    else if (numColumns > 0 && (readColumns(numColumns) || readColumns(numColumns)))
+    {
+        // A copy the writer overtook is taken again from the new end
+        drawSpans(g, 0, numColumns, columns[0]);
     }
-
-    g.strokePath(waveformPath, juce::PathStrokeType(1.5f));
 
     // Draw DC offset line (POST-filter - what's actually in the output)
     float dcY = yOffset - (dcOffsetPost * yScale);
@@ -145,7 +187,8 @@ void VisualizerComponent::paint(juce::Graphics& g)
     // Draw DC offset value (POST-filter)
     g.setColour(juce::Colours::white);
     g.setFont(12.0f);
-    juce::String dcText = "DC Out: " + juce::String(dcOffsetPost * 100.0f, 3) + "%";
+    juce::String dcText = "DC Out: "
+        + (snapshot.level != Metering::LEVEL_OFF ? juce::String(dcOffsetPost * 100.0f, 3) + "%" : juce::String("--"));
     g.drawText(dcText, 10, 10, 100, 20, juce::Justification::left);
 
     // Draw low-frequency energy meter (POST-filter - what's left after filtering)
@@ -179,6 +222,18 @@ void VisualizerComponent::paint(juce::Graphics& g)
         modeText = "2nd-order 20Hz HPF";
         modeColor = juce::Colours::cyan;
         break;
+    case 4: // 2nd-order variable
+        modeText = "2nd-order variable HPF (" + juce::String(cutoffParameter->load(), 1) + "Hz)";
+        modeColor = juce::Colours::lightblue;
+        break;
+    case 5: // 4th-order 20Hz
+        modeText = "4th-order 20Hz HPF (Butterworth)";
+        modeColor = juce::Colours::orange;
+        break;
+    case 6: // 8th-order 20Hz
+        modeText = "8th-order 20Hz HPF (Butterworth)";
+        modeColor = juce::Colours::magenta;
+        break;
     default:
         modeText = "Unknown";
         modeColor = juce::Colours::grey;
@@ -198,7 +253,240 @@ void VisualizerComponent::paint(juce::Graphics& g)
     {
         g.setColour(juce::Colours::yellow.withAlpha(0.7f));
         g.setFont(11.0f);
-        g.drawText("Stateful: y[n] = x[n] - x[n-1] + R·y[n-1]", getWidth() - 200, 10, 190, 20, juce::Justification::right);
+        g.drawText("Stateful: y[n] = x[n] - x[n-1] + R·y[n-1]", getWidth() - 200, 32, 190, 20, juce::Justification::right);
+    }
+}
+
+double VisualizerComponent::getWindowSamples() const
+{
+    auto sampleRate = audioProcessor.getSampleRate();
+    return windowSeconds * (sampleRate > 0.0 ? sampleRate : 44100.0);
+}
+
+VisualizerComponent::ColumnLayout VisualizerComponent::getColumnLayout() const
+{
+    // The window is rounded to a whole number of samples per column
+    const int width = juce::jmax(1, getWidth());
+    const int samplesPerColumn = juce::jmax(1, juce::roundToInt(getWindowSamples() / width));
+    const int level = NewProjectAudioProcessor::ScopePyramidType::findLevel(samplesPerColumn, (double)samplesPerColumn * width);
+
+    const auto available = level < 0 ? audioProcessor.getScopeRing().getWritePosition()
+                                     : audioProcessor.getScopePyramid().getSamplesAvailable(level);
+
+    return { samplesPerColumn, level, available / static_cast<juce::uint64>(samplesPerColumn) };
+}
+
+bool VisualizerComponent::continuesLayout(const ColumnLayout& layout) const
+{
+    return layout.samplesPerColumn == traceSamplesPerColumn && layout.level == traceLevel
+        && layout.endColumn >= traceEndColumn;
+}
+
+void VisualizerComponent::setDrawnLayout(const ColumnLayout& layout)
+{
+    traceSamplesPerColumn = layout.samplesPerColumn;
+    traceLevel = layout.level;
+    traceEndColumn = layout.endColumn;
+}
+
+bool VisualizerComponent::readColumns(int numColumns)
+{
+    const double windowSamples = getWindowSamples();
+
+    if (windowSamples >= numColumns * NewProjectAudioProcessor::ScopePyramidType::getBucketSize(0))
+        return audioProcessor.getScopePyramid().readColumns(windowSamples, columns.data(), numColumns, pyramidScratch.data());
+
+    // Fewer than a first-level bucket per column: straight from the samples
+    const auto& scopeRing = audioProcessor.getScopeRing();
+    const int numSamples = juce::jlimit(1, NewProjectAudioProcessor::scopeRingSize, static_cast<int>(std::ceil(windowSamples)));
+
+    if (! scopeRing.read(scopeRing.getWritePosition(), rawSamples.data(), numSamples))
+        return false;
+
+    mergeIntoColumns(rawSamples.data(), numSamples, columns.data(), numColumns);
+    return true;
+}
+
+bool VisualizerComponent::readAlignedColumns(int level, juce::uint64 endSample, int samplesPerColumn, int numColumns)
+{
+    if (level >= 0)
+        return audioProcessor.getScopePyramid().readAlignedColumns(level, endSample, samplesPerColumn,
+                                                                   columns.data(), numColumns, pyramidScratch.data());
+
+    const int numSamples = numColumns * samplesPerColumn;
+
+    if (numSamples > NewProjectAudioProcessor::scopeRingSize
+        || ! audioProcessor.getScopeRing().read(endSample, rawSamples.data(), numSamples))
+        return false;
+
+    mergeIntoColumns(rawSamples.data(), numSamples, columns.data(), numColumns);
+    return true;
+}
+
+void VisualizerComponent::renderScrollingTrace()
+{
+    const int width = getWidth();
+    const int height = getHeight();
+
+    if (width <= 0 || height <= 0)
+        return;
+
+    const auto layout = getColumnLayout();
+    const bool sameLayout = traceImage.getWidth() == width && traceImage.getHeight() == height
+                         && continuesLayout(layout)
+                         && layout.endColumn - traceEndColumn < static_cast<juce::uint64>(width);
+
+    const int numNew = sameLayout ? static_cast<int>(layout.endColumn - traceEndColumn) : width;
+
+    if (numNew == 0)
+        return;
+
+    if (! readAlignedColumns(layout.level, layout.endColumn * static_cast<juce::uint64>(layout.samplesPerColumn),
+                             layout.samplesPerColumn, numNew))
+    {
+        traceSamplesPerColumn = 0; // Overtaken: start over on the next frame
+        return;
+    }
+
+    if (traceImage.getWidth() != width || traceImage.getHeight() != height)
+        traceImage = juce::Image(juce::Image::ARGB, width, height, true);
+
+    if (sameLayout)
+    {
+        traceImage.moveImageSection(0, 0, numNew, 0, width - numNew, height);
+        traceImage.clear({ width - numNew, 0, numNew, height });
+    }
+    else
+    {
+        traceImage.clear(traceImage.getBounds());
+    }
+
+    juce::Graphics g(traceImage);
+    drawSpans(g, width - numNew, numNew, sameLayout ? traceLastSpan : columns[0]);
+
+    traceLastSpan = columns[static_cast<size_t>(numNew - 1)];
+    setDrawnLayout(layout);
+}
+
+void VisualizerComponent::renderPhosphor()
+{
+    const int width = getWidth();
+    const int height = getHeight();
+
+    if (width <= 0 || height <= 0)
+        return;
+
+    const auto layout = getColumnLayout();
+    const auto numPixels = static_cast<size_t>(width) * static_cast<size_t>(height);
+    const bool sameLayout = phosphorIntensity.size() == numPixels && continuesLayout(layout);
+
+    if (! sameLayout)
+        phosphorIntensity.assign(numPixels, 0.0f);
+
+    if (phosphorImage.getWidth() != width || phosphorImage.getHeight() != height)
+        phosphorImage = juce::Image(juce::Image::ARGB, width, height, true);
+
+    // Persistence of about two sweeps whatever the window length. Frames
+    // come at most 30 times a second but are skipped while the ring stands
+    // still and added by resizes, so the decay follows the time actually
+    // elapsed since the last rendered frame
+    const double now = juce::Time::getMillisecondCounterHiRes() * 0.001;
+    const double elapsed = sameLayout ? juce::jmax(0.0, now - phosphorLastRenderTime) : 0.0;
+    phosphorLastRenderTime = now;
+
+    const float decay = static_cast<float>(std::exp(-elapsed / juce::jmax(0.1, 2.0 * windowSeconds)));
+    juce::FloatVectorOperations::multiply(phosphorIntensity.data(), decay, static_cast<int>(numPixels));
+
+    // New columns, at most one sweep: short windows complete more than one
+    // per frame, and only the latest is still held by the ring or level
+    const auto numNew = juce::jmin(sameLayout ? layout.endColumn - traceEndColumn : layout.endColumn,
+                                   static_cast<juce::uint64>(width));
+
+    const float yScale = (float)height / 2.0f;
+    const float yOffset = (float)height / 2.0f;
+    const auto samplesPerColumn = static_cast<juce::uint64>(layout.samplesPerColumn);
+
+    const auto first = layout.endColumn - numNew;
+    const int count = static_cast<int>(numNew);
+
+    if (count > 0)
+    {
+        if (! readAlignedColumns(layout.level, layout.endColumn * samplesPerColumn, layout.samplesPerColumn, count))
+        {
+            traceSamplesPerColumn = 0; // Overtaken: start over on the next frame
+            return;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            const auto span = columns[static_cast<size_t>(i)];
+            const int top = juce::jlimit(0, height - 1, juce::roundToInt(yOffset - span.max * yScale));
+            const int bottom = juce::jlimit(0, height - 1, juce::roundToInt(yOffset - span.min * yScale));
+            const int numRows = bottom - top + 1;
+
+            // The beam's dwell is spread over the rows it crosses
+            const auto x = static_cast<size_t>((first + static_cast<juce::uint64>(i)) % static_cast<juce::uint64>(width));
+            juce::FloatVectorOperations::add(phosphorIntensity.data() + x * static_cast<size_t>(height) + static_cast<size_t>(top),
+                                             juce::jmin(1.0f, 2.0f / (float)numRows), numRows);
+        }
+    }
+
+    setDrawnLayout(layout);
+
+    // Intensity to colour
+    const float lutScale = (float)phosphorLutSize / phosphorLutRange;
+    juce::Image::BitmapData pixels(phosphorImage, juce::Image::BitmapData::writeOnly);
+
+    for (int x = 0; x < width; ++x)
+    {
+        const float* column = phosphorIntensity.data() + static_cast<size_t>(x) * static_cast<size_t>(height);
+
+        for (int y = 0; y < height; ++y)
+        {
+            const int index = juce::jmin(phosphorLutSize - 1, static_cast<int>(column[y] * lutScale));
+            reinterpret_cast<juce::PixelARGB*>(pixels.getPixelPointer(x, y))->set(phosphorLut[static_cast<size_t>(index)]);
+        }
+    }
+}
+
+void VisualizerComponent::buildPhosphorLut()
+{
+    // Transparent at rest, then blue, cyan, yellow and white as it heats up.
+    // The table covers 0..phosphorLutRange with a soft knee, so single
+    // passes show and dense traces saturate gently
+    const juce::Colour stops[] = { juce::Colours::transparentBlack, juce::Colours::blue.withAlpha(0.6f),
+                                   juce::Colours::cyan, juce::Colours::yellow, juce::Colours::white };
+    constexpr int numStops = static_cast<int>(sizeof(stops) / sizeof(stops[0]));
+
+    phosphorLut.resize(phosphorLutSize);
+
+    for (int i = 0; i < phosphorLutSize; ++i)
+    {
+        const float intensity = phosphorLutRange * (float)i / (float)phosphorLutSize;
+        const float heat = (1.0f - std::exp(-1.5f * intensity)) * (float)(numStops - 1);
+        const int stop = juce::jmin(numStops - 2, static_cast<int>(heat));
+
+        phosphorLut[static_cast<size_t>(i)] = stops[stop].interpolatedWith(stops[stop + 1], heat - (float)stop).getPixelARGB();
+    }
+}
+
+void VisualizerComponent::drawSpans(juce::Graphics& g, int firstX, int numSpans, ScopeSpan previous) const
+{
+    float yScale = (float)getHeight() / 2.0f;
+    float yOffset = (float)getHeight() / 2.0f;
+
+    g.setColour(juce::Colours::cyan.withAlpha(0.9f));
+
+    for (int i = 0; i < numSpans; ++i)
+    {
+        // Reach the previous column so steep edges stay joined
+        auto span = columns[static_cast<size_t>(i)];
+        const auto joined = ScopeSpan{ juce::jmin(span.min, previous.max), juce::jmax(span.max, previous.min) };
+        previous = span;
+
+        const float top = yOffset - joined.max * yScale;
+        const float bottom = yOffset - joined.min * yScale;
+        g.fillRect((float)(firstX + i), top - 0.75f, 1.0f, bottom - top + 1.5f);
     }
 }
 
@@ -206,17 +494,26 @@ void VisualizerComponent::resized()
 {
     backgroundGrid = juce::Image(); // Force grid redraw
     updateGridCache();
-}
 
-void VisualizerComponent::timerCallback()
-{
-    repaint();
+    columns.resize(static_cast<size_t>(getWidth()));
+    windowComboBox.setBounds(getWidth() - 90, 8, 80, 20);
+    displayModeComboBox.setBounds(getWidth() - 180, 8, 85, 20);
 }
 
 //==============================================================================
 // NewProjectAudioProcessorEditor Implementation
 //==============================================================================
 
+namespace
+{
+    // Labels only repaint when their text really changes
+    void setLabelText(juce::Label& label, const juce::String& text)
+    {
+        if (label.getText() != text)
+            label.setText(text, juce::dontSendNotification);
+    }
+}
+
 NewProjectAudioProcessorEditor::NewProjectAudioProcessorEditor(NewProjectAudioProcessor& p)
     : AudioProcessorEditor(&p), audioProcessor(p), visualizer(p)
 {
@@ -228,11 +525,39 @@ NewProjectAudioProcessorEditor::NewProjectAudioProcessorEditor(NewProjectAudioPr
     filterModeComboBox.addItem("1st-order DC blocker (6dB/oct, ~5Hz)", 2);
     filterModeComboBox.addItem("2nd-order 10Hz HPF (Gentle, 12dB/oct)", 3);
     filterModeComboBox.addItem("2nd-order 20Hz HPF (Standard, 12dB/oct)", 4);
+    filterModeComboBox.addItem("2nd-order variable HPF (12dB/oct)", 5);
+    filterModeComboBox.addItem("4th-order 20Hz HPF (Steep, 24dB/oct)", 6);
+    filterModeComboBox.addItem("8th-order 20Hz HPF (Brickwall, 48dB/oct)", 7);
     filterModeComboBox.setSelectedId(4); // Default to 20Hz
 
     filterModeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
         audioProcessor.apvts, "filterMode", filterModeComboBox);
 
+    // --- Cutoff Slider (variable mode) ---
+    addAndMakeVisible(cutoffSlider);
+    cutoffSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    cutoffSlider.setTextBoxStyle(juce::Slider::TextBoxRight, false, 60, 20);
+    cutoffSlider.setTextValueSuffix(" Hz");
+
+    cutoffAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "cutoff", cutoffSlider);
+
+    // --- Meter Channel Selector ---
+    addAndMakeVisible(meterChannelComboBox);
+    meterChannelComboBox.addItem("All channels (worst)", allChannelsItemId);
+    meterChannelComboBox.setSelectedId(allChannelsItemId, juce::dontSendNotification);
+
+    // --- Metering Level Selector ---
+    addAndMakeVisible(meteringLevelComboBox);
+    meteringLevelComboBox.addItem("Meters off", Metering::LEVEL_OFF + 1);
+    meteringLevelComboBox.addItem("Peak + DC", Metering::LEVEL_PEAK_DC + 1);
+    meteringLevelComboBox.addItem("Full metering", Metering::LEVEL_FULL + 1);
+
+    meteringLevelAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "meteringLevel", meteringLevelComboBox);
+
+    audioProcessor.addMetricsSubscriber();
+
     // --- Visualizer Toggle Button ---
     addAndMakeVisible(visualizerToggleButton);
     visualizerAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
@@ -316,53 +641,83 @@ NewProjectAudioProcessorEditor::NewProjectAudioProcessorEditor(NewProjectAudioPr
     infoLabel.setFont(16.0f);
     infoLabel.setText("Professional DC Filter", juce::dontSendNotification);
 
-    // Start metrics timer
-    metricsTimer.startTimerHz(10); // Update metrics 10 times per second
-
     updateMetricsDisplay();
 }
 
 NewProjectAudioProcessorEditor::~NewProjectAudioProcessorEditor()
 {
-    metricsTimer.stopTimer();
+    audioProcessor.removeMetricsSubscriber();
+}
+
+void NewProjectAudioProcessorEditor::onVBlank()
+{
+    const double now = juce::Time::getMillisecondCounterHiRes() * 0.001;
+
+    visualizer.refreshIfNewData(now);
+
+    // Labels at most 10 times a second
+    if (now - lastMetricsTime >= metricsInterval)
+    {
+        lastMetricsTime = now;
+        updateMetricsDisplay();
+    }
 }
 
 void NewProjectAudioProcessorEditor::updateMetricsDisplay()
 {
-    // PRE-filter values (input)
-    float dcOffsetPre = audioProcessor.getDCOffsetPre();
-    float rmsPre = audioProcessor.getRMSPre();
-    float peakPre = audioProcessor.getPeakPre();
-    float lowFreqPre = audioProcessor.getLowFreqPre();
+    updateFilterInfo();
+
+    // One consistent copy: every value below comes from the same update
+    const auto& snapshot = audioProcessor.getMetricsSnapshot();
+    updateMeterChannelItems(snapshot.numChannels);
+
+    // Nothing to do until a new update arrives or another channel is chosen
+    int selectedId = meterChannelComboBox.getSelectedId();
+
+    if (snapshot.updateIndex == shownUpdateIndex && selectedId == shownMeterChannelId)
+        return;
+
+    shownUpdateIndex = snapshot.updateIndex;
+    shownMeterChannelId = selectedId;
+
+    auto meters = selectedId > allChannelsItemId
+        ? snapshot.channels[static_cast<size_t>(selectedId - allChannelsItemId - 1)]
+        : snapshot.getWorstCase();
 
-    juce::String dcTextPre = "DC: " + juce::String(dcOffsetPre * 100.0f, 3) + "%";
-    juce::String rmsTextPre = "RMS: " + juce::String(rmsPre * 100.0f, 2) + "%";
-    juce::String peakTextPre = "Peak: " + juce::String(peakPre * 100.0f, 2) + "%";
-    juce::String lowFreqTextPre = "LF: " + juce::String(lowFreqPre * 100.0f, 2) + "%";
+    // Values the current metering level does not measure show as "--"
+    auto format = [&snapshot](const char* name, float value, int decimals, int level) {
+        return juce::String(name) + ": "
+            + (snapshot.level >= level ? juce::String(value * 100.0f, decimals) + "%" : juce::String("--"));
+        };
 
-    dcOffsetLabelPre.setText(dcTextPre, juce::dontSendNotification);
-    rmsLabelPre.setText(rmsTextPre, juce::dontSendNotification);
-    peakLabelPre.setText(peakTextPre, juce::dontSendNotification);
-    lowFreqLabelPre.setText(lowFreqTextPre, juce::dontSendNotification);
+    // PRE-filter values (input)
+    setLabelText(dcOffsetLabelPre, format("DC", meters.dcOffsetPre, 3, Metering::LEVEL_PEAK_DC));
+    setLabelText(rmsLabelPre, format("RMS", meters.rmsPre, 2, Metering::LEVEL_FULL));
+    setLabelText(peakLabelPre, format("Peak", meters.peakPre, 2, Metering::LEVEL_PEAK_DC));
+    setLabelText(lowFreqLabelPre, format("LF", meters.lowFreqPre, 2, Metering::LEVEL_FULL));
 
     // POST-filter values (output - what you actually hear)
-    float dcOffsetPost = audioProcessor.getDCOffsetPost();
-    float rmsPost = audioProcessor.getRMSPost();
-    float peakPost = audioProcessor.getPeakPost();
-    float lowFreqPost = audioProcessor.getLowFreqPost();
-
-    juce::String dcTextPost = "DC: " + juce::String(dcOffsetPost * 100.0f, 3) + "%";
-    juce::String rmsTextPost = "RMS: " + juce::String(rmsPost * 100.0f, 2) + "%";
-    juce::String peakTextPost = "Peak: " + juce::String(peakPost * 100.0f, 2) + "%";
-    juce::String lowFreqTextPost = "LF: " + juce::String(lowFreqPost * 100.0f, 2) + "%";
-
-    dcOffsetLabelPost.setText(dcTextPost, juce::dontSendNotification);
-    rmsLabelPost.setText(rmsTextPost, juce::dontSendNotification);
-    peakLabelPost.setText(peakTextPost, juce::dontSendNotification);
-    lowFreqLabelPost.setText(lowFreqTextPost, juce::dontSendNotification);
-
-    // Update filter info based on current mode
+    setLabelText(dcOffsetLabelPost, format("DC", meters.dcOffsetPost, 3, Metering::LEVEL_PEAK_DC));
+    setLabelText(rmsLabelPost, format("RMS", meters.rmsPost, 2, Metering::LEVEL_FULL));
+    setLabelText(peakLabelPost, format("Peak", meters.peakPost, 2, Metering::LEVEL_PEAK_DC));
+    setLabelText(lowFreqLabelPost, format("LF", meters.lowFreqPost, 2, Metering::LEVEL_FULL));
+}
+
+void NewProjectAudioProcessorEditor::updateFilterInfo()
+{
+    // Update filter info based on current mode, when it or the cutoff moved,
+    // or the cost of the last mode crossfade changed (in 0.1% steps)
     int filterMode = audioProcessor.getFilterMode();
+    double cutoff = cutoffSlider.getValue();
+    int transitionLoad = juce::roundToInt(audioProcessor.getTransitionLoad() * 1000.0);
+
+    if (filterMode == shownFilterMode && cutoff == shownCutoff && transitionLoad == shownTransitionLoad)
+        return;
+
+    shownFilterMode = filterMode;
+    shownCutoff = cutoff;
+    shownTransitionLoad = transitionLoad;
+
     juce::String filterInfo;
 
     switch (filterMode)
@@ -379,11 +734,43 @@ void NewProjectAudioProcessorEditor::updateMetricsDisplay()
     case 3:
         filterInfo = "2nd-order: Standard DC filter (20Hz, 12dB/oct)";
         break;
+    case 4:
+        filterInfo = "2nd-order: Variable DC filter (" + juce::String(cutoff, 1) + "Hz, 12dB/oct)";
+        break;
+    case 5:
+        filterInfo = "4th-order: Steep subsonic filter (20Hz Butterworth, 24dB/oct)";
+        break;
+    case 6:
+        filterInfo = "8th-order: Brickwall subsonic filter (20Hz Butterworth, 48dB/oct)";
+        break;
     default:
         filterInfo = "Unknown filter mode";
     }
 
-    filterInfoLabel.setText(filterInfo, juce::dontSendNotification);
+    if (transitionLoad > 0)
+        filterInfo += " | Crossfade: " + juce::String(transitionLoad / 10.0, 1) + "% CPU";
+
+    setLabelText(filterInfoLabel, filterInfo);
+}
+
+void NewProjectAudioProcessorEditor::updateMeterChannelItems(int numChannels)
+{
+    // One entry per metered channel; rebuilt only when the bus changes
+    if (numChannels == numChannelItems)
+        return;
+
+    int selectedId = meterChannelComboBox.getSelectedId();
+    meterChannelComboBox.clear(juce::dontSendNotification);
+    meterChannelComboBox.addItem("All channels (worst)", allChannelsItemId);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        meterChannelComboBox.addItem("Channel " + juce::String(ch + 1), allChannelsItemId + 1 + ch);
+
+    if (selectedId > allChannelsItemId + numChannels)
+        selectedId = allChannelsItemId;
+
+    meterChannelComboBox.setSelectedId(selectedId, juce::dontSendNotification);
+    numChannelItems = numChannels;
 }
 
 void NewProjectAudioProcessorEditor::paint(juce::Graphics& g)
@@ -423,13 +810,17 @@ void NewProjectAudioProcessorEditor::resized()
     auto headerArea = bounds.removeFromTop(40);
     infoLabel.setBounds(headerArea);
 
-    // Filter info area
+    // Filter info area, with the meter channel selector on the right
     auto filterInfoArea = bounds.removeFromTop(25);
+    meterChannelComboBox.setBounds(filterInfoArea.removeFromRight(150).reduced(2, 0));
+    meteringLevelComboBox.setBounds(filterInfoArea.removeFromRight(120).reduced(2, 0));
     filterInfoLabel.setBounds(filterInfoArea);
 
     // Control area
     auto controlArea = bounds.removeFromTop(35);
-    filterModeComboBox.setBounds(controlArea.removeFromLeft(controlArea.getWidth() * 0.7).reduced(2));
+    int controlWidth = controlArea.getWidth();
+    filterModeComboBox.setBounds(controlArea.removeFromLeft(controlWidth * 0.45).reduced(2));
+    cutoffSlider.setBounds(controlArea.removeFromLeft(controlWidth * 0.3).reduced(2));
     visualizerToggleButton.setBounds(controlArea.reduced(2));
 
     // PRE-filter metrics area
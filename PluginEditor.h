@@ -5,8 +5,7 @@
 //==============================================================================
 // Visualizer Component - shows waveform with DC offset reference
 //==============================================================================
-class VisualizerComponent : public juce::Component,
-    public juce::Timer
+class VisualizerComponent : public juce::Component
 {
 public:
     VisualizerComponent(NewProjectAudioProcessor& p);
@@ -14,15 +13,85 @@ public:
 
     void paint(juce::Graphics& g) override;
     void resized() override;
-    void timerCallback() override;
 
     void setVisualizerActive(bool active);
 
+    // Called by the editor's scheduler: repaints at most 30 times a second,
+    // and only when the scope ring has moved since the last frame
+    void refreshIfNewData(double nowSeconds);
+
 private:
     NewProjectAudioProcessor& audioProcessor;
+    std::atomic<float>* cutoffParameter; // For the variable mode's label
     juce::Image backgroundGrid;
     bool visualizerEnabled{ false };
 
+    static constexpr double frameInterval = 1.0 / 30.0;
+    double lastFrameTime{ 0.0 };
+    juce::uint64 lastFramePosition{ 0 };
+
+    // Time window on screen. The trace is one min/max span per pixel column,
+    // from raw samples for short windows and the processor's pyramid for
+    // long ones, so a frame costs the same at any window length
+    juce::ComboBox windowComboBox;
+    double windowSeconds{ 0.02 };
+
+    // How the trace is rendered
+    enum DisplayMode {
+        DISPLAY_TRACE = 1,   // Whole window drawn every frame
+        DISPLAY_SCROLL = 2,  // Persistent image, only new columns drawn
+        DISPLAY_PHOSPHOR = 3 // Free-running sweep with decaying persistence
+    };
+
+    juce::ComboBox displayModeComboBox;
+    int displayMode{ DISPLAY_TRACE };
+
+    std::vector<ScopeSpan> columns;
+    std::vector<ScopeSpan> pyramidScratch = std::vector<ScopeSpan>(NewProjectAudioProcessor::scopePyramidCapacity);
+    std::vector<float> rawSamples = std::vector<float>(NewProjectAudioProcessor::scopeRingSize);
+
+    // Scroll and phosphor modes only draw the columns that completed since
+    // the last frame. Columns sit at fixed sample positions (a whole number
+    // of samples each), and the layout last drawn with is kept to tell when
+    // the picture must start over; traceSamplesPerColumn 0 forces that
+    struct ColumnLayout
+    {
+        int samplesPerColumn;
+        int level;                // Pyramid level, or -1 for raw samples
+        juce::uint64 endColumn;   // Columns complete so far
+    };
+
+    int traceSamplesPerColumn{ 0 };
+    int traceLevel{ -1 };
+    juce::uint64 traceEndColumn{ 0 };
+
+    // Scroll mode: the trace on a transparent image, shifted left by the
+    // new columns
+    juce::Image traceImage;
+    ScopeSpan traceLastSpan{};
+
+    // Phosphor mode: beam intensity per pixel, column-major so that a span
+    // is one contiguous run. New columns are added at their sweep position,
+    // the whole buffer decays by the time since the last frame, and a
+    // lookup table maps it to colour
+    static constexpr int phosphorLutSize = 1024;
+    static constexpr float phosphorLutRange = 4.0f; // Intensity at the top of the table
+    std::vector<float> phosphorIntensity;
+    std::vector<juce::PixelARGB> phosphorLut;
+    juce::Image phosphorImage;
+    double phosphorLastRenderTime{ 0.0 };
+
+    double getWindowSamples() const;
+    ColumnLayout getColumnLayout() const;
+    bool continuesLayout(const ColumnLayout& layout) const;
+    void setDrawnLayout(const ColumnLayout& layout);
+    bool readColumns(int numColumns);
+    bool readAlignedColumns(int level, juce::uint64 endSample, int samplesPerColumn, int numColumns);
+    void renderScrollingTrace();
+    void renderPhosphor();
+    void buildPhosphorLut();
+    void drawSpans(juce::Graphics& g, int firstX, int numSpans, ScopeSpan previous) const;
+
     // Cached grid lines for performance
     std::vector<float> verticalGridLines;
     std::vector<float> horizontalGridLines;
@@ -49,11 +118,23 @@ private:
     juce::ComboBox filterModeComboBox;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> filterModeAttachment;
 
+    juce::Slider cutoffSlider;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> cutoffAttachment;
+
     juce::ToggleButton visualizerToggleButton{ "Show Visualizer" };
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> visualizerAttachment;
 
     VisualizerComponent visualizer;
 
+    // Which channel the metrics show: all (worst case) or one channel
+    static constexpr int allChannelsItemId = 1;
+    juce::ComboBox meterChannelComboBox;
+    int numChannelItems{ 0 };
+
+    // Metering level; the editor keeps the processor metering while it is open
+    juce::ComboBox meteringLevelComboBox;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> meteringLevelAttachment;
+
     // Info labels - PRE filter (Input)
     juce::Label preLabel;
     juce::Label dcOffsetLabelPre;
@@ -76,19 +157,24 @@ private:
 
     NewProjectAudioProcessor& audioProcessor;
 
-    // Simple timer for metrics update
-    class MetricsTimer : public juce::Timer
-    {
-    public:
-        MetricsTimer(NewProjectAudioProcessorEditor& editor) : owner(editor) {}
-        void timerCallback() override { owner.updateMetricsDisplay(); }
-    private:
-        NewProjectAudioProcessorEditor& owner;
-    };
-
-    MetricsTimer metricsTimer{ *this };
+    // What the labels show, to skip updates when nothing changed
+    static constexpr double metricsInterval = 0.1;
+    double lastMetricsTime{ 0.0 };
+    juce::uint64 shownUpdateIndex{ 0 };
+    int shownMeterChannelId{ 0 };
+    int shownFilterMode{ -1 };
+    double shownCutoff{ 0.0 };
+    int shownTransitionLoad{ -1 };
 
+    void onVBlank();
     void updateMetricsDisplay();
+    void updateFilterInfo();
+    void updateMeterChannelItems(int numChannels);
+
+    // One scheduler for the whole editor, driven by the display's vertical
+    // blank; it only runs while the editor is on screen. Declared last so
+    // it goes before anything it touches
+    juce::VBlankAttachment vblankAttachment{ this, [this] { onVBlank(); } };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NewProjectAudioProcessorEditor)
 };
\ No newline at end of file
@@ -1,6 +1,38 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+namespace
+{
+    // Channels a filter kernel runs on: the compile-time count for the mono
+    // and stereo instantiations (so their channel loops unroll), otherwise
+    // what both the block and the filter state have
+    template <int fixedChannels, typename SampleType>
+    int getNumChannelsToProcess(const juce::dsp::AudioBlock<SampleType>& block, size_t numStates)
+    {
+        if constexpr (fixedChannels > 0)
+        {
+            jassert(block.getNumChannels() >= static_cast<size_t>(fixedChannels)
+                    && numStates >= static_cast<size_t>(fixedChannels));
+            juce::ignoreUnused(block, numStates);
+            return fixedChannels;
+        }
+        else
+        {
+            return static_cast<int>(juce::jmin(block.getNumChannels(), numStates));
+        }
+    }
+
+    // Metering copies are float whatever the processing precision
+    template <typename SampleType>
+    void copyForMetering(const SampleType* source, int numSamples, float* dest)
+    {
+        if constexpr (std::is_same_v<SampleType, float>)
+            std::copy(source, source + numSamples, dest);
+        else
+            std::transform(source, source + numSamples, dest, [](SampleType x) { return static_cast<float>(x); });
+    }
+}
+
 //==============================================================================
 NewProjectAudioProcessor::NewProjectAudioProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -15,12 +47,26 @@ NewProjectAudioProcessor::NewProjectAudioProcessor()
 #endif
     , apvts(*this, nullptr, "Parameters", createParameterLayout())
 {
-    // Initialize FIFO to zero
-    std::fill(std::begin(visualizerFifo), std::end(visualizerFifo), 0.0f);
+    filterModeParameter = apvts.getRawParameterValue("filterMode");
+    crossfadeParameter = apvts.getRawParameterValue("modeCrossfade");
+    cutoffParameter = apvts.getRawParameterValue("cutoff");
+    meteringLevelParameter = apvts.getRawParameterValue("meteringLevel");
+    apvts.addParameterListener("filterMode", this);
+
+    setKernelVariant(DCFilterKernelsISA::getBestSupportedVariant());
 }
 
 NewProjectAudioProcessor::~NewProjectAudioProcessor()
 {
+    apvts.removeParameterListener("filterMode", this);
+}
+
+void NewProjectAudioProcessor::setKernelVariant(DCFilterKernelsISA::Variant variant)
+{
+    selectedKernelVariant.store(variant, std::memory_order_relaxed);
+
+    if (isaKernels == nullptr)
+        isaKernels = &DCFilterKernelsISA::getKernels(variant);
 }
 
 //==============================================================================
@@ -58,9 +104,37 @@ bool NewProjectAudioProcessor::isMidiEffect() const
 
 double NewProjectAudioProcessor::getTailLengthSeconds() const
 {
-    // 1st-order filter has infinite impulse response technically, but very short tail
-    // 2nd-order filters have ~50-100ms tail depending on cutoff
-    return 0.1; // Conservative estimate
+    // Time for the current mode's slowest pole to take a full-scale state
+    // down to silenceThreshold, where the silence fast path takes over
+    const double sampleRate = currentSampleRate;
+    const double radius = getPoleRadius(currentFilterMode.load(std::memory_order_relaxed), sampleRate);
+
+    if (radius <= 0.0 || radius >= 1.0)
+        return 0.0;
+
+    return std::log(silenceThreshold) / std::log(radius) / sampleRate;
+}
+
+double NewProjectAudioProcessor::getPoleRadius(int mode, double sampleRate) const
+{
+    switch (mode)
+    {
+    case MODE_DC_1POLE:
+        return std::exp(-juce::MathConstants<double>::twoPi * CUTOFF_1POLE / sampleRate);
+    case MODE_2POLE_10HZ:
+        return DCFilterKernels::getButterworthPoleRadius(sampleRate, CUTOFF_10HZ, 2);
+    case MODE_2POLE_20HZ:
+        return DCFilterKernels::getButterworthPoleRadius(sampleRate, CUTOFF_20HZ, 2);
+    case MODE_2POLE_VARIABLE:
+        return DCFilterKernels::getButterworthPoleRadius(sampleRate,
+            cutoffParameter->load(std::memory_order_relaxed), 2);
+    case MODE_4POLE_20HZ:
+        return DCFilterKernels::getButterworthPoleRadius(sampleRate, CUTOFF_20HZ, 4);
+    case MODE_8POLE_20HZ:
+        return DCFilterKernels::getButterworthPoleRadius(sampleRate, CUTOFF_20HZ, 8);
+    default:
+        return 0.0; // Bypass has no state
+    }
 }
 
 int NewProjectAudioProcessor::getNumPrograms()
@@ -94,49 +168,79 @@ void NewProjectAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
 {
     currentSampleRate = sampleRate;
 
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
+    preparedBlockSize = juce::jmax(1, samplesPerBlock);
+
+    int numChannels = getTotalNumOutputChannels();
+
+    // Everything the audio thread needs per chunk comes from here: the
+    // retiring filter path during a mode crossfade and the cutoff ramp
+    // (cutoffs plus three coefficient arrays). Sized for double so either
+    // precision fits
+    scratchArena.prepare<double>(static_cast<size_t>(fusedChunkSize * (numChannels + 4)));
+
+    isaKernels = &DCFilterKernelsISA::getKernels(selectedKernelVariant.load(std::memory_order_relaxed));
+
+    // Set initial filter coefficients and state for both precisions; the
+    // host picks one before playback starts
+    prepareDSPState<float>(numChannels);
+    prepareDSPState<double>(numChannels);
+
+    cutoffSmoother.reset(sampleRate, cutoffSmoothingSeconds);
+    cutoffSmoother.setCurrentAndTargetValue(floatState.variableCutoff);
+    activeMode = currentFilterMode.load(std::memory_order_relaxed);
+
+    // Mono and stereo get kernels with the channel count built in
+    preparedNumChannels = numChannels;
+    channelClass = numChannels == 1 ? CHANNELS_MONO : (numChannels == 2 ? CHANNELS_STEREO : CHANNELS_ANY);
+    selectKernels();
+
+    // Start from the parameter's current value; anything still queued is
+    // already reflected in it
+    ModeChangeEvent staleEvent;
+    while (modeChangeQueue.pop(staleEvent)) {}
 
-    filterChain2Pole.prepare(spec);
-    analysisFilterChain.prepare(spec);
+    requestedMode = juce::jlimit(0, NUM_FILTER_MODES - 1,
+        static_cast<int>(filterModeParameter->load(std::memory_order_relaxed)));
+    numPendingModeChanges = 0;
+    timelinePosition = 0;
 
-    // Set initial filter coefficients
-    updateFilterCoefficients();
-    updateAnalysisFilterCoefficients();
-    updateOnePoleCoefficients();
+    // No transition in flight after a (re)prepare
+    transitionSamplesRemaining = 0;
+    transitionLoad.reset(sampleRate, preparedBlockSize);
 
-    // Initialize 1st-order DC blocker state (per channel)
-    int numChannels = static_cast<int>(spec.numChannels);
-    dcXPrev.assign(numChannels, 0.0f);
-    dcYPrev.assign(numChannels, 0.0f);
+    // Clear the scope ring, the pyramid and their sample counters
+    scopeRing.reset();
+    scopePyramid.reset();
 
-    // Clear FIFO and reset write index
-    std::fill(std::begin(visualizerFifo), std::end(visualizerFifo), 0.0f);
-    fifoWriteIndex.store(0, std::memory_order_relaxed);
+    // Cleared meters, and the analyzer back on the pool with the new ring
+    meteringAnalyzer.prepare(sampleRate, numChannels, preparedBlockSize, *isaKernels);
+    meteringLevel = Metering::LEVEL_OFF;
+}
+
+template <typename SampleType>
+void NewProjectAudioProcessor::prepareDSPState(int numChannels)
+{
+    auto& state = getDSPState<SampleType>();
+
+    updateModeCoefficientTable<SampleType>();
+    updateOnePoleCoefficients<SampleType>();
 
-    // Reset all metrics
-    dcOffsetPre.store(0.0f, std::memory_order_relaxed);
-    rmsPre.store(0.0f, std::memory_order_relaxed);
-    peakPre.store(0.0f, std::memory_order_relaxed);
-    lowFreqPre.store(0.0f, std::memory_order_relaxed);
+    // Initialize 1st-order DC blocker state (one SIMD lane per channel)
+    state.dcLaneState.assign(static_cast<size_t>(DCFilterKernels::getNumLaneGroups<SampleType>(numChannels)), {});
 
-    dcOffsetPost.store(0.0f, std::memory_order_relaxed);
-    rmsPost.store(0.0f, std::memory_order_relaxed);
-    peakPost.store(0.0f, std::memory_order_relaxed);
-    lowFreqPost.store(0.0f, std::memory_order_relaxed);
+    for (auto& channels : state.highPassState)
+        channels.assign(static_cast<size_t>(numChannels), {});
 
-    rmsSumPre = 0.0f;
-    rmsSumPost = 0.0f;
-    lowFreqSumPre = 0.0f;
-    lowFreqSumPost = 0.0f;
-    rmsSampleCount = 0;
+    for (auto& channels : state.cascadeState)
+        channels.assign(static_cast<size_t>(numChannels), {});
+
+    state.transitionChannels.assign(static_cast<size_t>(numChannels), nullptr);
 }
 
 void NewProjectAudioProcessor::releaseResources()
 {
-    // Resources released automatically
+    // Off the analysis pool until the next prepareToPlay
+    meteringAnalyzer.release();
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -146,8 +250,11 @@ bool NewProjectAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts
     juce::ignoreUnused(layouts);
     return true;
 #else
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-        && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Any layout up to maxChannels: every channel is filtered the same way,
+    // so surround, ambisonic and discrete buses are all just channel counts
+    const auto& output = layouts.getMainOutputChannelSet();
+
+    if (output.isDisabled() || output.size() > maxChannels)
         return false;
 
 #if ! JucePlugin_IsSynth
@@ -160,195 +267,503 @@ bool NewProjectAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts
 }
 #endif
 
-void NewProjectAudioProcessor::updateFilterCoefficients()
+template <typename SampleType>
+void NewProjectAudioProcessor::updateModeCoefficientTable()
 {
-    // Update 2nd-order filter coefficients based on current mode
-    int mode = currentFilterMode.load(std::memory_order_relaxed);
-    float cutoff = (mode == MODE_2POLE_10HZ) ? CUTOFF_10HZ : CUTOFF_20HZ;
+    // Build every mode's coefficients up front (message thread, from
+    // prepareToPlay) so a mode switch on the audio thread is an index change
+    // with no trig and no allocation
+    auto& state = getDSPState<SampleType>();
+
+    for (int mode = 0; mode < NUM_FILTER_MODES; ++mode)
+    {
+        auto& coefs = state.modeCoefficients[static_cast<size_t>(mode)];
 
-    auto coefficients = FilterCoefs::makeHighPass(currentSampleRate, cutoff);
-    *filterChain2Pole.get<0>().coefficients = *coefficients;
+        // 2nd-order high-pass cutoff (only used by the 2-pole modes)
+        float highPassCutoff = (mode == MODE_2POLE_10HZ) ? CUTOFF_10HZ : CUTOFF_20HZ;
+
+        if (mode == MODE_2POLE_VARIABLE)
+        {
+            highPassCutoff = cutoffParameter->load(std::memory_order_relaxed);
+            state.variableCutoff = highPassCutoff;
+        }
+
+        coefs.highPass = DCFilterKernels::makeSVFSection<SampleType>(currentSampleRate, highPassCutoff);
+
+        if (mode == MODE_4POLE_20HZ)
+            DCFilterKernels::makeButterworthCascade(currentSampleRate, CUTOFF_20HZ, 4, coefs.cascade);
+        else if (mode == MODE_8POLE_20HZ)
+            DCFilterKernels::makeButterworthCascade(currentSampleRate, CUTOFF_20HZ, 8, coefs.cascade);
+
+        updateBlockCoefficients(coefs);
+    }
 }
 
-void NewProjectAudioProcessor::updateAnalysisFilterCoefficients()
+template <typename SampleType>
+void NewProjectAudioProcessor::updateBlockCoefficients(ModeCoefficients<SampleType>& coefs)
 {
-    // Create a low-pass filter at the appropriate cutoff
-    int mode = currentFilterMode.load(std::memory_order_relaxed);
-    float cutoff = CUTOFF_20HZ; // Default
-
-    if (mode == MODE_2POLE_10HZ) {
-        cutoff = CUTOFF_10HZ;
+    // Each path only bakes the matrices its kernel reads
+    if constexpr (std::is_same_v<SampleType, float>)
+    {
+        DCFilterKernelsISA::makeSVFWideCoefficients(coefs.highPass.k, coefs.highPass.a1, coefs.highPass.a2,
+            coefs.highPass.a3, true, isaKernels->svfWidth, coefs.highPassWide);
     }
-    else if (mode == MODE_DC_1POLE) {
-        cutoff = CUTOFF_1POLE; // 1st-order filter targets ~5Hz
+    else
+    {
+        DCFilterKernels::makeSVFBlockCoefficients(coefs.highPass, DCFilterKernels::SVFOutput::highPass,
+            coefs.highPassBlock);
     }
-    // MODE_BYPASS uses the default 20Hz for analysis
+}
 
-    auto coefficients = FilterCoefs::makeLowPass(currentSampleRate, cutoff);
-    *analysisFilterChain.get<0>().coefficients = *coefficients;
+template <typename SampleType>
+void NewProjectAudioProcessor::processHighPassSection(SampleType* data, int numSamples,
+    const ModeCoefficients<SampleType>& coefs, DCFilterKernels::SVFState<SampleType>& state)
+{
+    if constexpr (std::is_same_v<SampleType, float>)
+        isaKernels->svfTimeParallel(data, numSamples, coefs.highPassWide, state.ic1eq, state.ic2eq);
+    else
+        DCFilterKernels::processSVFTimeParallel(data, numSamples, coefs.highPass, coefs.highPassBlock, state);
 }
 
+template <typename SampleType>
 void NewProjectAudioProcessor::updateOnePoleCoefficients()
 {
     // CORRECTED: Use exact discrete-time coefficient
     // R = exp(-2π * fc / fs)
     // For fc = 5Hz at 44.1kHz: R = exp(-2π * 5 / 44100) ≈ 0.999285
     // For fc = 5Hz at 48kHz: R = exp(-2π * 5 / 48000) ≈ 0.999345
+    auto& state = getDSPState<SampleType>();
 
-    float omega = 2.0f * juce::MathConstants<float>::pi * CUTOFF_1POLE / currentSampleRate;
-    dcR = std::exp(-omega);
+    auto omega = static_cast<SampleType>(juce::MathConstants<SampleType>::twoPi * CUTOFF_1POLE / currentSampleRate);
+    state.dcR = std::exp(-omega);
+
+    DCFilterKernels::makeOnePoleBlockCoefficients(state.dcR, state.dcBlockCoefs);
 }
 
-void NewProjectAudioProcessor::updatePreFilterMetrics(const juce::AudioBuffer<float>& buffer)
+template <typename SampleType>
+void NewProjectAudioProcessor::pushToVisualizer(const SampleType* data, int numSamples)
 {
-    int numSamples = buffer.getNumSamples();
+    scopeRing.push(data, numSamples);
+    scopePyramid.push(data, numSamples);
+}
 
-    if (buffer.getNumChannels() > 0)
-    {
-        auto* channelData = buffer.getReadPointer(0);
-        float sum = 0.0f;
-        float peak = 0.0f;
+template <int fixedChannels, typename SampleType>
+void NewProjectAudioProcessor::processOnePoleDCBlocker(juce::dsp::AudioBlock<SampleType> block)
+{
+    // CORRECTED: Canonical 1st-order DC blocker with persistent state
+    // y[n] = x[n] - x[n-1] + R * y[n-1]
+    // State persists forever across blocks
+    auto& state = getDSPState<SampleType>();
+
+    constexpr int lanes = DCFilterKernels::numLanes<SampleType>;
+    int numChannels = getNumChannelsToProcess<fixedChannels>(block, state.dcLaneState.size() * lanes);
+    int numSamples = static_cast<int>(block.getNumSamples());
 
-        // Calculate DC offset and peak for pre-filter
-        for (int i = 0; i < numSamples; ++i)
+    if (numChannels * 2 <= lanes)
+    {
+        // Mono/stereo would leave most channel lanes idle, so run each
+        // channel through the time-parallel kernel instead. The state stays
+        // in the channel's lane so both kernels share it.
+        for (int ch = 0; ch < numChannels; ++ch)
         {
-            float sample = channelData[i];
-            sum += sample;
-            peak = juce::jmax(peak, std::abs(sample));
-            rmsSumPre += sample * sample;
+            auto& group = state.dcLaneState[static_cast<size_t>(ch / lanes)];
+            auto lane = static_cast<size_t>(ch % lanes);
+            SampleType xPrev = group.xPrev.get(lane);
+            SampleType yPrev = group.yPrev.get(lane);
+
+            DCFilterKernels::processOnePoleTimeParallel(block.getChannelPointer(static_cast<size_t>(ch)),
+                numSamples, state.dcR, state.dcBlockCoefs, xPrev, yPrev);
+
+            group.xPrev.set(lane, xPrev);
+            group.yPrev.set(lane, yPrev);
         }
+    }
+    else
+    {
+        // Each group of channels in one pass, one channel per SIMD lane
+        for (int first = 0; first < numChannels; first += lanes)
+        {
+            SampleType* groupChannels[lanes] = {};
+            int activeLanes = juce::jmin(lanes, numChannels - first);
+
+            for (int lane = 0; lane < activeLanes; ++lane)
+                groupChannels[lane] = block.getChannelPointer(static_cast<size_t>(first + lane));
 
-        dcOffsetPre.store(sum / numSamples, std::memory_order_relaxed);
-        peakPre.store(peak, std::memory_order_relaxed);
+            DCFilterKernels::processOnePoleLaneGroup(groupChannels, activeLanes, numSamples,
+                state.dcR, state.dcLaneState[static_cast<size_t>(first / lanes)]);
+        }
+    }
+}
 
-        // Calculate low-frequency energy for pre-filter
-        // Create a temporary buffer for analysis
-        juce::AudioBuffer<float> tempBuffer(1, numSamples);
-        tempBuffer.copyFrom(0, 0, channelData, numSamples);
+template <int fixedChannels, typename SampleType>
+void NewProjectAudioProcessor::processHighPass(juce::dsp::AudioBlock<SampleType> block, int mode)
+{
+    // 2nd-order high-pass, numLanes consecutive samples per vector step.
+    // Each 2-pole mode keeps its own state so two can run side by side
+    auto& state = getDSPState<SampleType>();
+    processHighPassChannels<fixedChannels>(block, state.modeCoefficients[static_cast<size_t>(mode)],
+        state.highPassState[static_cast<size_t>(mode)]);
+}
 
-        // Apply low-pass filter to isolate frequencies below cutoff
-        juce::dsp::AudioBlock<float> block(tempBuffer);
-        juce::dsp::ProcessContextReplacing<float> context(block);
-        analysisFilterChain.process(context);
+template <int fixedChannels, typename SampleType>
+void NewProjectAudioProcessor::processHighPassChannels(juce::dsp::AudioBlock<SampleType> block,
+    const ModeCoefficients<SampleType>& coefs, std::vector<DCFilterKernels::SVFState<SampleType>>& channels)
+{
+    constexpr int lanes = DCFilterKernels::numLanes<SampleType>;
+    int numChannels = getNumChannelsToProcess<fixedChannels>(block, channels.size());
+    int numSamples = static_cast<int>(block.getNumSamples());
 
-        // Calculate RMS of low-frequency content
-        float lowFreqRMS = 0.0f;
-        auto* lowFreqData = tempBuffer.getReadPointer(0);
-        for (int i = 0; i < numSamples; ++i)
+    if (numChannels * 2 <= lanes)
+    {
+        // Too few channels to fill the lanes (same split as the 1st-order
+        // blocker): run each one through the time-parallel kernel
+        for (int ch = 0; ch < numChannels; ++ch)
         {
-            lowFreqRMS += lowFreqData[i] * lowFreqData[i];
-            lowFreqSumPre += lowFreqData[i] * lowFreqData[i];
+            processHighPassSection(block.getChannelPointer(static_cast<size_t>(ch)), numSamples, coefs,
+                channels[static_cast<size_t>(ch)]);
         }
+    }
+    else
+    {
+        // Wide layouts: one channel per lane, so the cost grows by one
+        // register step per numLanes channels
+        for (int first = 0; first < numChannels; first += lanes)
+        {
+            SampleType* groupChannels[lanes] = {};
+            int activeLanes = juce::jmin(lanes, numChannels - first);
 
-        rmsSampleCount += numSamples;
+            for (int lane = 0; lane < activeLanes; ++lane)
+                groupChannels[lane] = block.getChannelPointer(static_cast<size_t>(first + lane));
 
-        // Update RMS and low frequency every rmsUpdateInterval samples
-        if (rmsSampleCount >= rmsUpdateInterval)
-        {
-            rmsPre.store(std::sqrt(rmsSumPre / rmsSampleCount), std::memory_order_relaxed);
-            lowFreqPre.store(std::sqrt(lowFreqSumPre / rmsSampleCount), std::memory_order_relaxed);
-            rmsSumPre = 0.0f;
-            lowFreqSumPre = 0.0f;
-            rmsSampleCount = 0;
+            DCFilterKernels::processSVFLaneGroup(groupChannels, activeLanes, numSamples, coefs.highPass,
+                channels.data() + first);
         }
     }
 }
 
-void NewProjectAudioProcessor::updatePostFilterMetrics(const juce::AudioBuffer<float>& buffer)
+template <int fixedChannels, typename SampleType>
+void NewProjectAudioProcessor::processCascade(juce::dsp::AudioBlock<SampleType> block, int mode)
 {
-    int numSamples = buffer.getNumSamples();
+    // 4th/8th-order high-pass: all sections advance together, one per lane
+    auto& state = getDSPState<SampleType>();
+    auto& channels = state.cascadeState[static_cast<size_t>(mode)];
+    int numChannels = getNumChannelsToProcess<fixedChannels>(block, channels.size());
+    int numSamples = static_cast<int>(block.getNumSamples());
+    const auto& cascade = state.modeCoefficients[static_cast<size_t>(mode)].cascade;
+    constexpr int lanes = DCFilterKernels::numLanes<SampleType>;
+
+    if (numChannels * 2 <= lanes)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            DCFilterKernels::processSVFCascade(block.getChannelPointer(static_cast<size_t>(ch)), numSamples,
+                cascade, channels[static_cast<size_t>(ch)]);
+        }
+    }
+    else
+    {
+        // Wide layouts: one channel per lane, all sections in turn
+        for (int first = 0; first < numChannels; first += lanes)
+        {
+            SampleType* groupChannels[lanes] = {};
+            int activeLanes = juce::jmin(lanes, numChannels - first);
+
+            for (int lane = 0; lane < activeLanes; ++lane)
+                groupChannels[lane] = block.getChannelPointer(static_cast<size_t>(first + lane));
 
-    if (buffer.getNumChannels() > 0)
+            DCFilterKernels::processSVFCascadeLaneGroup(groupChannels, activeLanes, numSamples, cascade,
+                channels.data() + first);
+        }
+    }
+}
+
+template <int fixedChannels, typename SampleType>
+void NewProjectAudioProcessor::processVariableHighPass(juce::dsp::AudioBlock<SampleType> block)
+{
+    // Same section as the fixed modes. While the cutoff holds still it runs
+    // through the time-parallel kernel; during a sweep the coefficients are
+    // recomputed per sample from g alone
+    auto& state = getDSPState<SampleType>();
+    auto& channels = state.highPassState[MODE_2POLE_VARIABLE];
+    auto& coefs = state.modeCoefficients[MODE_2POLE_VARIABLE];
+    int numChannels = getNumChannelsToProcess<fixedChannels>(block, channels.size());
+    int numSamples = static_cast<int>(block.getNumSamples());
+
+    if (!cutoffSmoother.isSmoothing())
     {
-        auto* channelData = buffer.getReadPointer(0);
-        float sum = 0.0f;
-        float peak = 0.0f;
+        // Settled on a new value: bake it into the block coefficients once
+        float cutoff = cutoffSmoother.getCurrentValue();
 
-        // Calculate DC offset and peak for post-filter
-        for (int i = 0; i < numSamples; ++i)
+        if (cutoff != state.variableCutoff)
         {
-            float sample = channelData[i];
-            sum += sample;
-            peak = juce::jmax(peak, std::abs(sample));
-            rmsSumPost += sample * sample;
+            coefs.highPass = DCFilterKernels::makeSVFSection<SampleType>(currentSampleRate, cutoff);
+            updateBlockCoefficients(coefs);
+            state.variableCutoff = cutoff;
         }
 
-        dcOffsetPost.store(sum / numSamples, std::memory_order_relaxed);
-        peakPost.store(peak, std::memory_order_relaxed);
+        processHighPassChannels<fixedChannels>(block, coefs, channels);
+        return;
+    }
 
-        // The low-frequency content should be much lower after filtering
-        // Create a temporary buffer for analysis
-        juce::AudioBuffer<float> tempBuffer(1, numSamples);
-        tempBuffer.copyFrom(0, 0, channelData, numSamples);
+    // Blocks reaching here are at most fusedChunkSize long. The ramp is
+    // handed back on return, so every chunk of a sweep fits the arena
+    const ScratchArena::ScopedMark scratchMark(scratchArena);
+    auto rampSize = static_cast<size_t>(numSamples);
+    auto* cutoffs = scratchArena.allocate<SampleType>(rampSize);
+    DCFilterKernels::SVFRamp<SampleType> ramp{ scratchArena.allocate<SampleType>(rampSize),
+        scratchArena.allocate<SampleType>(rampSize), scratchArena.allocate<SampleType>(rampSize) };
 
-        // Reset analysis filter for accurate post-filter measurement
-        analysisFilterChain.reset();
+    if (cutoffs == nullptr || ramp.a1 == nullptr || ramp.a2 == nullptr || ramp.a3 == nullptr)
+        return;
 
-        // Apply low-pass filter
-        juce::dsp::AudioBlock<float> block(tempBuffer);
-        juce::dsp::ProcessContextReplacing<float> context(block);
-        analysisFilterChain.process(context);
+    for (int i = 0; i < numSamples; ++i)
+        cutoffs[i] = cutoffSmoother.getNextValue();
 
-        // Calculate RMS of remaining low-frequency content
-        float lowFreqRMS = 0.0f;
-        auto* lowFreqData = tempBuffer.getReadPointer(0);
-        for (int i = 0; i < numSamples; ++i)
+    auto piOverSampleRate = static_cast<SampleType>(juce::MathConstants<double>::pi / currentSampleRate);
+    DCFilterKernels::makeSVFRamp(cutoffs, numSamples, piOverSampleRate, coefs.highPass.k, ramp);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        DCFilterKernels::processSVFModulated(block.getChannelPointer(static_cast<size_t>(ch)), numSamples,
+            coefs.highPass.k, ramp, channels[static_cast<size_t>(ch)]);
+    }
+}
+
+template <typename SampleType>
+void NewProjectAudioProcessor::processModeFilter(juce::dsp::AudioBlock<SampleType> block, int mode)
+{
+    if (mode == MODE_DC_1POLE)
+        processOnePoleDCBlocker(block);
+    else if (mode == MODE_2POLE_VARIABLE)
+        processVariableHighPass(block);
+    else if (isHighPassMode(mode))
+        processHighPass(block, mode);
+    else if (isCascadeMode(mode))
+        processCascade(block, mode);
+    // MODE_BYPASS: nothing to do
+}
+
+template <typename SampleType>
+void NewProjectAudioProcessor::beginModeTransition(int newMode, juce::dsp::AudioBlock<SampleType> block)
+{
+    // Start the incoming path from a state that already matches the signal,
+    // instead of zero: the low-frequency content the outgoing path has been
+    // tracking is handed over, so the new path has no start-up transient
+    auto& state = getDSPState<SampleType>();
+
+    // Only channels with prepared state, as in every kernel
+    constexpr int lanes = DCFilterKernels::numLanes<SampleType>;
+    int numChannels = juce::jmin(static_cast<int>(block.getNumChannels()), preparedNumChannels);
+    bool fromHighPass = isHighPassMode(activeMode);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto& group = state.dcLaneState[static_cast<size_t>(ch / lanes)];
+        auto lane = static_cast<size_t>(ch % lanes);
+        auto index = static_cast<size_t>(ch);
+
+        // Low-frequency estimate of the outgoing path (bypass has none, which
+        // makes the incoming filter settle from the dry signal)
+        SampleType lowFrequency = 0;
+
+        if (fromHighPass)
+            lowFrequency = state.highPassState[static_cast<size_t>(activeMode)][index].ic2eq;
+        else if (isCascadeMode(activeMode))
+            lowFrequency = state.cascadeState[static_cast<size_t>(activeMode)][index].sections[0].ic2eq;
+        else if (activeMode == MODE_DC_1POLE)
+            lowFrequency = group.xPrev.get(lane) - group.yPrev.get(lane);
+
+        if (isHighPassMode(newMode))
+        {
+            auto& section = state.highPassState[static_cast<size_t>(newMode)][index];
+
+            if (fromHighPass)
+                section = state.highPassState[static_cast<size_t>(activeMode)][index];
+            else
+                section = { 0, lowFrequency }; // SVF at rest on a constant input
+        }
+        else if (isCascadeMode(newMode))
+        {
+            // At rest on a constant input the first section holds it and
+            // passes nothing on to the others
+            auto& cascade = state.cascadeState[static_cast<size_t>(newMode)][index];
+            cascade = {};
+            cascade.sections[0] = { 0, lowFrequency };
+        }
+        else if (newMode == MODE_DC_1POLE)
         {
-            lowFreqRMS += lowFreqData[i] * lowFreqData[i];
-            lowFreqSumPost += lowFreqData[i] * lowFreqData[i];
+            // y[n-1] = x[n-1] - DC, with x[n-1] taken as the first new sample
+            SampleType x0 = block.getChannelPointer(index)[0];
+            group.xPrev.set(lane, x0);
+            group.yPrev.set(lane, x0 - lowFrequency);
         }
+    }
+
+    transitionFromMode = activeMode;
+    activeMode = newMode;
+    currentFilterMode.store(newMode, std::memory_order_relaxed);
+    selectKernels();
+
+    float crossfadeMs = crossfadeParameter->load(std::memory_order_relaxed);
+    transitionLength = juce::roundToInt(crossfadeMs * 0.001 * currentSampleRate);
+    transitionSamplesRemaining = transitionLength;
+}
+
+template <typename SampleType>
+void NewProjectAudioProcessor::mixTransition(juce::dsp::AudioBlock<SampleType> chunk,
+    juce::dsp::AudioBlock<SampleType> oldPath)
+{
+    // Linear crossfade from the retiring path to the new one. Both are the
+    // same input through different filters, so the signals are correlated
+    // and equal-gain keeps the level constant. Gains come from the absolute
+    // fade position so they do not depend on how the block was split
+    int numSamples = static_cast<int>(chunk.getNumSamples());
+    int fadeSamples = juce::jmin(numSamples, transitionSamplesRemaining);
+    SampleType step = SampleType(1) / static_cast<SampleType>(transitionLength);
+    int elapsed = transitionLength - transitionSamplesRemaining;
+
+    for (size_t ch = 0; ch < chunk.getNumChannels(); ++ch)
+    {
+        SampleType* out = chunk.getChannelPointer(ch);
+        const SampleType* old = oldPath.getChannelPointer(ch);
 
-        // We use the same rmsSampleCount as pre-filter
-        if (rmsSampleCount >= rmsUpdateInterval)
+        for (int i = 0; i < fadeSamples; ++i)
         {
-            rmsPost.store(std::sqrt(rmsSumPost / rmsSampleCount), std::memory_order_relaxed);
-            lowFreqPost.store(std::sqrt(lowFreqSumPost / rmsSampleCount), std::memory_order_relaxed);
-            rmsSumPost = 0.0f;
-            lowFreqSumPost = 0.0f;
+            SampleType gain = static_cast<SampleType>(elapsed + i + 1) * step;
+            out[i] = old[i] + (out[i] - old[i]) * gain;
         }
     }
+
+    transitionSamplesRemaining -= fadeSamples;
 }
 
-void NewProjectAudioProcessor::processOnePoleDCBlocker(juce::AudioBuffer<float>& buffer)
+template <int mode, int fixedChannels, typename SampleType>
+void NewProjectAudioProcessor::processFused(juce::dsp::AudioBlock<SampleType> block, juce::int64 timelineSample,
+    bool feedVisualizer)
 {
-    // CORRECTED: Canonical 1st-order DC blocker with persistent state
-    // y[n] = x[n] - x[n-1] + R * y[n-1]
-    // State persists forever across blocks
+    // One traversal per chunk: input copy for metering, filter, output copy
+    // and visualizer feed all run on fusedChunkSize samples while they are
+    // in L1. Every channel is metered; the visualizer follows channel 0.
+    auto& state = getDSPState<SampleType>();
 
-    int numChannels = buffer.getNumChannels();
-    int numSamples = buffer.getNumSamples();
+    int numSamples = static_cast<int>(block.getNumSamples());
+    auto numChannels = static_cast<size_t>(getNumChannelsToProcess<fixedChannels>(block,
+        state.transitionChannels.size()));
 
-    for (int ch = 0; ch < numChannels; ++ch)
+    // Input and output of every channel for the metering analyzer. If it has
+    // fallen behind the block goes unmetered; the audio never waits for it
+    auto& meteringRing = meteringAnalyzer.getRing();
+    float* meterData = nullptr;
+
+    if (meteringLevel != Metering::LEVEL_OFF)
+        meterData = meteringRing.beginRecord(static_cast<int>(numChannels), numSamples, timelineSample,
+            getAnalysisCutoff(mode), meteringLevel);
+
+    auto meterStride = static_cast<size_t>(numSamples);
+
+    // Bypass with nothing to meter, draw or fade leaves the block as it is
+    if constexpr (mode == MODE_BYPASS)
+    {
+        if (meterData == nullptr && ! feedVisualizer && transitionSamplesRemaining == 0)
+            return;
+    }
+
+    // Working copy for the retiring path while a mode crossfade runs
+    juce::dsp::AudioBlock<SampleType> oldPath;
+
+    if (transitionSamplesRemaining > 0)
     {
-        float* channelData = buffer.getWritePointer(ch);
-        float xPrev = dcXPrev[ch];
-        float yPrev = dcYPrev[ch];
+        auto* oldPathData = scratchArena.allocate<SampleType>(numChannels * static_cast<size_t>(fusedChunkSize));
 
-        for (int i = 0; i < numSamples; ++i)
+        if (oldPathData == nullptr)
+        {
+            transitionSamplesRemaining = 0;
+        }
+        else
         {
-            float x = channelData[i];
+            for (size_t ch = 0; ch < numChannels; ++ch)
+                state.transitionChannels[ch] = oldPathData + ch * static_cast<size_t>(fusedChunkSize);
+
+            oldPath = juce::dsp::AudioBlock<SampleType>(state.transitionChannels.data(), numChannels,
+                static_cast<size_t>(fusedChunkSize));
+        }
+    }
 
-            // CORRECT FORMULA: y[n] = x[n] - x[n-1] + R * y[n-1]
-            float y = x - xPrev + dcR * yPrev;
+    for (int start = 0; start < numSamples; start += fusedChunkSize)
+    {
+        int chunkSize = juce::jmin(fusedChunkSize, numSamples - start);
+        auto chunk = block.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(chunkSize));
+        if (meterData != nullptr)
+        {
+            for (size_t ch = 0; ch < numChannels; ++ch)
+                copyForMetering(chunk.getChannelPointer(ch), chunkSize, meterData + ch * meterStride + start);
+        }
 
-            // Apply filter
-            channelData[i] = y;
+        // During a crossfade the retiring path runs on a copy of the input.
+        // Its cost is timed separately so the overhead can be read back
+        // The new path's own pass is not part of that: it runs anyway
+        bool inTransition = transitionSamplesRemaining > 0;
+        double transitionMs = 0.0;
+        juce::dsp::AudioBlock<SampleType> oldChunk;
 
-            // Update state for next sample
-            xPrev = x;
-            yPrev = y;
+        if (inTransition)
+        {
+            const double oldPathStartMs = juce::Time::getMillisecondCounterHiRes();
+            oldChunk = oldPath.getSubsetChannelBlock(0, numChannels).getSubBlock(0, static_cast<size_t>(chunkSize));
+            oldChunk.copyFrom(chunk.getSubsetChannelBlock(0, numChannels));
+            processModeFilter(oldChunk, transitionFromMode);
+            transitionMs = juce::Time::getMillisecondCounterHiRes() - oldPathStartMs;
         }
 
-        // Store state for next block
-        dcXPrev[ch] = xPrev;
-        dcYPrev[ch] = yPrev;
+        if constexpr (mode == MODE_DC_1POLE)
+            processOnePoleDCBlocker<fixedChannels>(chunk);
+        else if constexpr (mode == MODE_2POLE_VARIABLE)
+            processVariableHighPass<fixedChannels>(chunk);
+        else if constexpr (isHighPassMode(mode))
+            processHighPass<fixedChannels>(chunk, mode);
+        else if constexpr (isCascadeMode(mode))
+            processCascade<fixedChannels>(chunk, mode);
+
+        if (inTransition)
+        {
+            const double mixStartMs = juce::Time::getMillisecondCounterHiRes();
+            mixTransition(chunk.getSubsetChannelBlock(0, numChannels), oldChunk);
+            transitionMs += juce::Time::getMillisecondCounterHiRes() - mixStartMs;
+            transitionLoad.registerRenderTime(transitionMs, chunkSize);
+        }
+
+        // TRUE BYPASS leaves the chunk untouched, so this is the input there
+        if (meterData != nullptr)
+        {
+            for (size_t ch = 0; ch < numChannels; ++ch)
+                copyForMetering(chunk.getChannelPointer(ch), chunkSize,
+                    meterData + (numChannels + ch) * meterStride + start);
+        }
+
+        if (feedVisualizer)
+            pushToVisualizer(chunk.getChannelPointer(0), chunkSize);
     }
+
+    if (meterData != nullptr)
+        meteringRing.commitRecord();
 }
 
 void NewProjectAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
-    juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
+    processBuffer(buffer);
+}
+
+void NewProjectAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused(midiMessages);
+    processBuffer(buffer);
+}
+
+template <typename SampleType>
+void NewProjectAudioProcessor::processBuffer(juce::AudioBuffer<SampleType>& buffer)
+{
+    juce::ScopedNoDenormals noDenormals;
 
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -357,84 +772,310 @@ void NewProjectAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    // 1. Get PRE-filter metrics (input signal)
-    updatePreFilterMetrics(buffer);
+    if (buffer.getNumChannels() == 0 || buffer.getNumSamples() == 0 || preparedBlockSize == 0)
+        return;
 
-    // 2. Get current filter mode from parameters - CORRECTED: Use parameter as-is
-    int newFilterMode = static_cast<int>(*apvts.getRawParameterValue("filterMode"));
-    int oldFilterMode = currentFilterMode.exchange(newFilterMode, std::memory_order_relaxed);
+    // Some hosts send more than the samplesPerBlock they announced. Work in
+    // prepared-size pieces (no copies - just views into the buffer)
+    juce::dsp::AudioBlock<SampleType> block(buffer);
+    auto numSamples = block.getNumSamples();
+    auto maxBlockSize = static_cast<size_t>(preparedBlockSize);
 
-    // 3. Store a copy of the input buffer for visualizer when in bypass
-    juce::AudioBuffer<float> inputBufferCopy;
-    bool needVisualizer = visualizerActive.load(std::memory_order_relaxed);
+    auto blockStart = getBlockTimelinePosition();
+    collectModeChanges(blockStart);
+    updateMeteringLevel(blockStart);
 
-    if (needVisualizer && newFilterMode == MODE_BYPASS)
-    {
-        inputBufferCopy.makeCopyOf(buffer);
-    }
+    // Also split wherever a queued mode change falls due, so it lands on
+    // its exact sample
+    size_t start = 0;
 
-    // 4. Check if we need to update filter coefficients due to mode change
-    if (newFilterMode != oldFilterMode)
+    while (start < numSamples)
     {
-        if (newFilterMode == MODE_DC_1POLE)
+        auto timelineSample = blockStart + static_cast<juce::int64>(start);
+        int numApplied = 0;
+
+        while (numApplied < numPendingModeChanges
+               && pendingModeChanges[static_cast<size_t>(numApplied)].timelineSample <= timelineSample)
         {
-            // Only need to update analysis filter coefficients for 1st-order mode
-            updateAnalysisFilterCoefficients();
-            // NOTE: Do NOT reset the 1st-order filter state!
-            // State persists forever for proper DC blocker operation
+            requestedMode = pendingModeChanges[static_cast<size_t>(numApplied)].mode;
+            ++numApplied;
         }
-        else if (newFilterMode == MODE_2POLE_10HZ || newFilterMode == MODE_2POLE_20HZ)
+
+        if (numApplied > 0)
         {
-            // Reset 2nd-order filter state and update coefficients
-            filterChain2Pole.reset();
-            updateFilterCoefficients();
-            updateAnalysisFilterCoefficients();
+            std::copy(pendingModeChanges.begin() + numApplied,
+                pendingModeChanges.begin() + numPendingModeChanges, pendingModeChanges.begin());
+            numPendingModeChanges -= numApplied;
         }
-        else if (newFilterMode == MODE_BYPASS)
+
+        auto end = juce::jmin(numSamples, start + maxBlockSize);
+
+        if (numPendingModeChanges > 0)
+        {
+            auto due = static_cast<size_t>(pendingModeChanges[0].timelineSample - blockStart);
+            end = juce::jmin(end, due);
+        }
+
+        // A change held back by a running crossfade starts when the fade
+        // ends, so split there too
+        if (transitionSamplesRemaining > 0 && requestedMode != activeMode)
+            end = juce::jmin(end, start + static_cast<size_t>(transitionSamplesRemaining));
+
+        processSubBlock(block.getSubBlock(start, end - start), timelineSample);
+        start = end;
+    }
+
+    timelinePosition = blockStart + static_cast<juce::int64>(numSamples);
+}
+
+void NewProjectAudioProcessor::parameterChanged(const juce::String& parameterID, float newValue)
+{
+    // Any thread. The queue holds far more changes than arrive between two
+    // blocks; if it ever fills, the change is dropped
+    if (parameterID == "filterMode")
+        modeChangeQueue.push({ juce::roundToInt(newValue) });
+}
+
+void NewProjectAudioProcessor::updateMeteringLevel(juce::int64 blockStart)
+{
+    // Nobody reading the meters means nothing to measure, whatever the
+    // parameter says
+    int level = Metering::LEVEL_OFF;
+
+    if (metricsSubscribers.load(std::memory_order_relaxed) > 0)
+        level = juce::jlimit(0, Metering::NUM_LEVELS - 1,
+            juce::roundToInt(meteringLevelParameter->load(std::memory_order_relaxed)));
+
+    // An empty record tells the analyzer metering stopped, so it clears the
+    // meters. If its ring is full this block is still metered and the next
+    // one tries again
+    if (level == Metering::LEVEL_OFF && meteringLevel != Metering::LEVEL_OFF)
+    {
+        auto& meteringRing = meteringAnalyzer.getRing();
+
+        if (meteringRing.beginRecord(preparedNumChannels, 0, blockStart, 0.0f, level) == nullptr)
+            return;
+
+        meteringRing.commitRecord();
+    }
+
+    meteringLevel = level;
+}
+
+juce::int64 NewProjectAudioProcessor::getBlockTimelinePosition()
+{
+    // Host position while the transport runs, otherwise our own counter
+    if (auto* playHead = getPlayHead())
+    {
+        if (auto position = playHead->getPosition())
         {
-            // Bypass mode - update analysis filter to default 20Hz
-            updateAnalysisFilterCoefficients();
+            if (position->getIsPlaying())
+            {
+                if (auto hostSample = position->getTimeInSamples())
+                {
+                    // Locate or loop: anything still pending belongs to the
+                    // old timeline position, so apply it straight away
+                    if (*hostSample != timelinePosition)
+                        for (int i = 0; i < numPendingModeChanges; ++i)
+                            pendingModeChanges[static_cast<size_t>(i)].timelineSample = *hostSample;
+
+                    return *hostSample;
+                }
+            }
         }
     }
 
-    // 5. Apply appropriate filter based on mode
-    if (newFilterMode == MODE_BYPASS)
+    return timelinePosition;
+}
+
+void NewProjectAudioProcessor::collectModeChanges(juce::int64 blockStart)
+{
+    // A change seen before this block takes effect at the first grid boundary
+    // after the block's start. That is the same sample for every buffer size
+    // that divides the grid
+    auto grid = static_cast<juce::int64>(automationGridSize);
+    auto due = (blockStart >= 0 ? blockStart / grid : (blockStart - grid + 1) / grid) * grid + grid;
+
+    ModeChangeEvent event;
+
+    while (modeChangeQueue.pop(event))
     {
-        // TRUE BYPASS: Do absolutely nothing to the audio
-        // Audio passes through unchanged
+        int mode = juce::jlimit(0, NUM_FILTER_MODES - 1, event.mode);
+
+        // Only the last value per boundary matters
+        if (numPendingModeChanges > 0
+            && pendingModeChanges[static_cast<size_t>(numPendingModeChanges - 1)].timelineSample == due)
+        {
+            pendingModeChanges[static_cast<size_t>(numPendingModeChanges - 1)].mode = mode;
+        }
+        else if (numPendingModeChanges < static_cast<int>(pendingModeChanges.size()))
+        {
+            pendingModeChanges[static_cast<size_t>(numPendingModeChanges++)] = { due, mode };
+        }
+        else
+        {
+            pendingModeChanges.back().mode = mode;
+        }
     }
-    else if (newFilterMode == MODE_DC_1POLE)
+}
+
+template <typename SampleType>
+void NewProjectAudioProcessor::processSubBlock(juce::dsp::AudioBlock<SampleType> block, juce::int64 timelineSample)
+{
+    scratchArena.reset();
+
+    cutoffSmoother.setTargetValue(cutoffParameter->load(std::memory_order_relaxed));
+
+    // 1. requestedMode was brought up to date for this sub-block's first
+    // sample by processBuffer. On a mode change, crossfade from the old
+    // filter path to the new one. A change that arrives mid-fade waits for
+    // it to finish, so at most two paths ever run at once
+    if (requestedMode != activeMode && transitionSamplesRemaining == 0)
+        beginModeTransition(requestedMode, block);
+
+    // The visualizer only runs if explicitly enabled
+    bool needVisualizer = visualizerActive.load(std::memory_order_relaxed);
+
+    // 2. Silence in, filter at rest: silence out. Bypass leaves even silence
+    // untouched, and a crossfade or cutoff sweep takes the normal path
+    if (activeMode != MODE_BYPASS && transitionSamplesRemaining == 0
+        && ! (activeMode == MODE_2POLE_VARIABLE && cutoffSmoother.isSmoothing())
+        && isFilterStateDecayed<SampleType>(activeMode) && isSilent(block))
     {
-        // 1st-order DC blocker with persistent state
-        processOnePoleDCBlocker(buffer);
+        processSilence(block, timelineSample, needVisualizer);
+        return;
     }
-    else if (newFilterMode == MODE_2POLE_10HZ || newFilterMode == MODE_2POLE_20HZ)
+
+    // 3. Run the kernel selected for this mode and channel layout
+    auto& state = getDSPState<SampleType>();
+
+    // A host may hand over fewer channels than the layout promised
+    auto kernel = block.getNumChannels() == static_cast<size_t>(preparedNumChannels)
+        ? state.activeKernel
+        : getKernelTable<SampleType>()[static_cast<size_t>(activeMode)][CHANNELS_ANY];
+
+    (this->*kernel)(block, timelineSample, needVisualizer);
+}
+
+template <typename SampleType>
+bool NewProjectAudioProcessor::isSilent(juce::dsp::AudioBlock<SampleType> block)
+{
+    const auto threshold = static_cast<SampleType>(silenceThreshold);
+
+    for (size_t ch = 0; ch < block.getNumChannels(); ++ch)
     {
-        // 2nd-order filter with selectable cutoff
-        juce::dsp::AudioBlock<float> block(buffer);
-        juce::dsp::ProcessContextReplacing<float> context(block);
-        filterChain2Pole.process(context);
+        auto range = juce::FloatVectorOperations::findMinAndMax(block.getChannelPointer(ch),
+            static_cast<int>(block.getNumSamples()));
+
+        if (range.getStart() < -threshold || range.getEnd() > threshold)
+            return false;
     }
 
-    // 6. Get POST-filter metrics (output signal - what you actually hear)
-    updatePostFilterMetrics(buffer);
+    return true;
+}
 
-    // 7. VISUALIZER LOGIC: Only runs if explicitly enabled
-    if (needVisualizer)
+template <typename SampleType>
+bool NewProjectAudioProcessor::isFilterStateDecayed(int mode)
+{
+    // Runs before the input is scanned, so audio that is playing costs a
+    // look at a few state values per block and nothing more
+    auto& state = getDSPState<SampleType>();
+    const auto threshold = static_cast<SampleType>(silenceThreshold);
+    auto isSmall = [threshold](SampleType x) { return std::abs(x) <= threshold; };
+
+    if (mode == MODE_DC_1POLE)
     {
-        // Determine which buffer to use for visualizer
-        auto* channelData = (newFilterMode == MODE_BYPASS) ?
-            inputBufferCopy.getReadPointer(0) :
-            buffer.getReadPointer(0);
-        int numSamples = buffer.getNumSamples();
-
-        // Push samples to lock-free FIFO
-        for (int i = 0; i < numSamples; ++i)
+        constexpr int lanes = DCFilterKernels::numLanes<SampleType>;
+
+        for (int ch = 0; ch < preparedNumChannels; ++ch)
         {
-            int writePos = fifoWriteIndex.fetch_add(1, std::memory_order_relaxed) % fifoSize;
-            visualizerFifo[writePos] = channelData[i];
+            const auto& group = state.dcLaneState[static_cast<size_t>(ch / lanes)];
+            auto lane = static_cast<size_t>(ch % lanes);
+
+            if (! isSmall(group.xPrev.get(lane)) || ! isSmall(group.yPrev.get(lane)))
+                return false;
         }
     }
+    else if (isHighPassMode(mode))
+    {
+        for (const auto& section : state.highPassState[static_cast<size_t>(mode)])
+            if (! isSmall(section.ic1eq) || ! isSmall(section.ic2eq))
+                return false;
+    }
+    else if (isCascadeMode(mode))
+    {
+        for (const auto& cascade : state.cascadeState[static_cast<size_t>(mode)])
+            for (const auto& section : cascade.sections)
+                if (! isSmall(section.ic1eq) || ! isSmall(section.ic2eq))
+                    return false;
+    }
+
+    return true;
+}
+
+template <typename SampleType>
+void NewProjectAudioProcessor::clearFilterState(int mode)
+{
+    auto& state = getDSPState<SampleType>();
+
+    if (mode == MODE_DC_1POLE)
+        std::fill(state.dcLaneState.begin(), state.dcLaneState.end(), DCFilterKernels::OnePoleLaneState<SampleType>{});
+    else if (isHighPassMode(mode))
+        std::fill(state.highPassState[static_cast<size_t>(mode)].begin(),
+            state.highPassState[static_cast<size_t>(mode)].end(), DCFilterKernels::SVFState<SampleType>{});
+    else if (isCascadeMode(mode))
+        std::fill(state.cascadeState[static_cast<size_t>(mode)].begin(),
+            state.cascadeState[static_cast<size_t>(mode)].end(), DCFilterKernels::SVFCascadeState<SampleType>{});
+}
+
+template <typename SampleType>
+void NewProjectAudioProcessor::processSilence(juce::dsp::AudioBlock<SampleType> block, juce::int64 timelineSample,
+    bool feedVisualizer)
+{
+    // What is left in the state is below the threshold; resume from exact zero
+    clearFilterState<SampleType>(activeMode);
+    block.clear();
+
+    int numSamples = static_cast<int>(block.getNumSamples());
+    int numChannels = juce::jmin(static_cast<int>(block.getNumChannels()), preparedNumChannels);
+
+    // The analyzer takes the block as zeros; nothing is copied
+    if (meteringLevel != Metering::LEVEL_OFF)
+        meteringAnalyzer.getRing().pushSilentRecord(numChannels, numSamples, timelineSample,
+            getAnalysisCutoff(activeMode), meteringLevel);
+
+    // The scope keeps moving, in the same pieces as the fused kernel
+    if (feedVisualizer)
+    {
+        for (int start = 0; start < numSamples; start += fusedChunkSize)
+            pushToVisualizer(block.getChannelPointer(0) + start, juce::jmin(fusedChunkSize, numSamples - start));
+    }
+}
+
+template <typename SampleType, size_t... modes>
+constexpr NewProjectAudioProcessor::KernelTable<SampleType>
+    NewProjectAudioProcessor::makeKernelTable(std::index_sequence<modes...>)
+{
+    return { { { &NewProjectAudioProcessor::processFused<static_cast<int>(modes), 1, SampleType>,
+                 &NewProjectAudioProcessor::processFused<static_cast<int>(modes), 2, SampleType>,
+                 &NewProjectAudioProcessor::processFused<static_cast<int>(modes), 0, SampleType> }... } };
+}
+
+template <typename SampleType>
+const NewProjectAudioProcessor::KernelTable<SampleType>& NewProjectAudioProcessor::getKernelTable()
+{
+    // Every mode x channel class instantiation of processFused, built at
+    // compile time
+    static constexpr auto table = makeKernelTable<SampleType>(std::make_index_sequence<NUM_FILTER_MODES>());
+    return table;
+}
+
+void NewProjectAudioProcessor::selectKernels()
+{
+    // Called from prepareToPlay and on every mode switch, never per block
+    auto mode = static_cast<size_t>(activeMode);
+    floatState.activeKernel = getKernelTable<float>()[mode][static_cast<size_t>(channelClass)];
+    doubleState.activeKernel = getKernelTable<double>()[mode][static_cast<size_t>(channelClass)];
 }
 
 //==============================================================================
@@ -477,10 +1118,26 @@ juce::AudioProcessorValueTreeState::ParameterLayout NewProjectAudioProcessor::cr
     filterModes.add("1st-order DC blocker (6dB/oct)");
     filterModes.add("2nd-order 10Hz (12dB/oct)");
     filterModes.add("2nd-order 20Hz (12dB/oct)");
+    filterModes.add("2nd-order variable (12dB/oct)");
+    filterModes.add("4th-order 20Hz (24dB/oct)");
+    filterModes.add("8th-order 20Hz (48dB/oct)");
 
     layout.add(std::make_unique<juce::AudioParameterChoice>("filterMode", "Filter Mode",
         filterModes, 3)); // Default to 20Hz
 
+    // Corner of the variable 2nd-order mode, smoothed per sample
+    juce::NormalisableRange<float> cutoffRange(1.0f, 80.0f, 0.01f);
+    cutoffRange.setSkewForCentre(CUTOFF_20HZ);
+    layout.add(std::make_unique<juce::AudioParameterFloat>("cutoff", "Cutoff (Hz)", cutoffRange, CUTOFF_20HZ));
+
+    // Crossfade between the old and new filter paths on a mode change
+    layout.add(std::make_unique<juce::AudioParameterFloat>("modeCrossfade", "Mode Crossfade (ms)",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 20.0f));
+
+    // What the meters measure, cheapest first; off whenever no editor is open
+    layout.add(std::make_unique<juce::AudioParameterChoice>("meteringLevel", "Metering",
+        juce::StringArray{ "Off", "Peak + DC", "Full" }, Metering::LEVEL_FULL));
+
     // Visualizer state (GUI only, doesn't affect audio processing)
     layout.add(std::make_unique<juce::AudioParameterBool>("visualizer", "Visualizer", false));
 
@@ -1,8 +1,16 @@
 #pragma once
 
 #include <JuceHeader.h>
-
-class NewProjectAudioProcessor : public juce::AudioProcessor
+#include "DCFilterKernels.h"
+#include "DCFilterKernelsISA.h"
+#include "ScratchArena.h"
+#include "ParameterEventQueue.h"
+#include "ScopeRing.h"
+#include "ScopePyramid.h"
+#include "MeteringAnalyzer.h"
+
+class NewProjectAudioProcessor : public juce::AudioProcessor,
+                                 private juce::AudioProcessorValueTreeState::Listener
 {
 public:
     NewProjectAudioProcessor();
@@ -16,6 +24,16 @@ public:
 #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+
+    // 64-bit hosts can hand us their buffers directly instead of converting
+    bool supportsDoublePrecisionProcessing() const override { return true; }
+
+    // ISA build of the float kernels, picked from the CPU at construction.
+    // Can be forced (e.g. to compare variants); takes effect at the next
+    // prepareToPlay. Unsupported variants fall back to the baseline
+    void setKernelVariant(DCFilterKernelsISA::Variant variant);
+    DCFilterKernelsISA::Variant getKernelVariant() const { return isaKernels->variant; }
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override;
@@ -40,48 +58,133 @@ public:
 
     // Visualizer support - helper methods for GUI thread
     void setVisualizerState(bool active) { visualizerActive.store(active, std::memory_order_relaxed); }
-    float getNextSampleForVisualizer(int index) const { return visualizerFifo[index % fifoSize]; }
 
-    // Pre-filter metrics (input signal)
-    float getDCOffsetPre() const { return dcOffsetPre.load(std::memory_order_relaxed); }
-    float getRMSPre() const { return rmsPre.load(std::memory_order_relaxed); }
-    float getPeakPre() const { return peakPre.load(std::memory_order_relaxed); }
-    float getLowFreqPre() const { return lowFreqPre.load(std::memory_order_relaxed); }
+    // Metering (see MeteringAnalyzer.h)
+    using MeterValues = Metering::MeterValues;
+    using MetricsSnapshot = Metering::MetricsSnapshot;
+    static constexpr int maxChannels = Metering::maxChannels;
+
+    // Message thread only. Latest snapshot, read in one consistent copy; the
+    // reference stays valid until the next call
+    const MetricsSnapshot& getMetricsSnapshot() { return meteringAnalyzer.getSnapshot(); }
 
-    // Post-filter metrics (output signal - what you actually hear)
-    float getDCOffsetPost() const { return dcOffsetPost.load(std::memory_order_relaxed); }
-    float getRMSPost() const { return rmsPost.load(std::memory_order_relaxed); }
-    float getPeakPost() const { return peakPost.load(std::memory_order_relaxed); }
-    float getLowFreqPost() const { return lowFreqPost.load(std::memory_order_relaxed); }
+    // Metering only runs while someone reads it: at the "meteringLevel"
+    // parameter's level while there is at least one subscriber, otherwise
+    // off. The editor subscribes while it is open. Any thread
+    void addMetricsSubscriber() { metricsSubscribers.fetch_add(1, std::memory_order_relaxed); }
+    void removeMetricsSubscriber() { metricsSubscribers.fetch_sub(1, std::memory_order_relaxed); }
 
     // Get current filter mode for display
     int getFilterMode() const { return currentFilterMode.load(std::memory_order_relaxed); }
 
-    // Public so visualizer can access the size and write index
-    static constexpr int fifoSize = 1024;
-    std::atomic<int> fifoWriteIndex{ 0 };
+    // Share of the real-time budget spent on mode crossfades: the retiring
+    // path and the mix, not the new path's own pass (0 when none has run).
+    // Shown next to the filter description
+    double getTransitionLoad() const { return transitionLoad.getLoadAsProportion(); }
 
-private:
-    // Filter types
-    using Filter = juce::dsp::IIR::Filter<float>;
-    using FilterCoefs = juce::dsp::IIR::Coefficients<float>;
+    // Post-filter samples of channel 0 for the scope, pushed once per chunk
+    // while the visualizer is on. The editor is the only reader. Short
+    // windows are drawn from the raw samples, longer ones from the min/max
+    // pyramid (buckets of 4 to 1024 samples, 4096 of each)
+    static constexpr int scopeRingSize = 16384;
+    static constexpr int scopePyramidLevels = 5;
+    static constexpr int scopePyramidCapacity = 4096;
+    using ScopePyramidType = ScopePyramid<scopePyramidLevels, scopePyramidCapacity>;
+
+    const ScopeRing<scopeRingSize>& getScopeRing() const { return scopeRing; }
+    const ScopePyramidType& getScopePyramid() const { return scopePyramid; }
 
+private:
     // Filter modes - CORRECTED: 0 = BYPASS
     enum FilterMode {
         MODE_BYPASS = 0,          // No processing at all
         MODE_DC_1POLE = 1,        // 1st-order DC blocker (6dB/oct)
         MODE_2POLE_10HZ = 2,      // 2nd-order 10Hz (12dB/oct)
-        MODE_2POLE_20HZ = 3       // 2nd-order 20Hz (12dB/oct)
+        MODE_2POLE_20HZ = 3,      // 2nd-order 20Hz (12dB/oct)
+        MODE_2POLE_VARIABLE = 4,  // 2nd-order, cutoff parameter (12dB/oct)
+        MODE_4POLE_20HZ = 5,      // 4th-order 20Hz (24dB/oct)
+        MODE_8POLE_20HZ = 6,      // 8th-order 20Hz (48dB/oct)
+        NUM_FILTER_MODES
+    };
+
+    static constexpr bool isHighPassMode(int mode)
+    {
+        return mode == MODE_2POLE_10HZ || mode == MODE_2POLE_20HZ || mode == MODE_2POLE_VARIABLE;
+    }
+
+    static constexpr bool isCascadeMode(int mode)
+    {
+        return mode == MODE_4POLE_20HZ || mode == MODE_8POLE_20HZ;
+    }
+
+    // Coefficients for every mode, computed in prepareToPlay. The audio
+    // thread only changes activeMode on a mode switch
+    template <typename SampleType>
+    struct ModeCoefficients
+    {
+        // 2nd-order high-pass (TPT state-variable form, see DCFilterKernels.h)
+        DCFilterKernels::SVFSection<SampleType> highPass;
+
+        // Its lookahead matrices: at the ISA kernels' width for float, at the
+        // SIMDRegister width for double. Only the one for SampleType is built
+        DCFilterKernelsISA::SVFWideCoefficients highPassWide;
+        DCFilterKernels::SVFBlockCoefficients<SampleType> highPassBlock;
+
+        // Higher-order Butterworth sections (only used by the cascade modes)
+        DCFilterKernels::SVFCascade<SampleType> cascade;
+    };
+
+    template <typename SampleType>
+    using FusedKernel = void (NewProjectAudioProcessor::*)(juce::dsp::AudioBlock<SampleType>, juce::int64, bool);
+
+    // Filter state for one sample type. Both are prepared; the host's
+    // processing precision decides which one runs
+    template <typename SampleType>
+    struct DSPState
+    {
+        // processFused instantiation for the active mode and channel layout
+        FusedKernel<SampleType> activeKernel{ nullptr };
+
+        std::array<ModeCoefficients<SampleType>, NUM_FILTER_MODES> modeCoefficients;
+
+        // 2nd-order high-pass state per mode (only the 2-pole entries are
+        // used) and per channel
+        std::array<std::vector<DCFilterKernels::SVFState<SampleType>>, NUM_FILTER_MODES> highPassState;
+
+        // Cascade state per mode (only the cascade entries are used) and per channel
+        std::array<std::vector<DCFilterKernels::SVFCascadeState<SampleType>>, NUM_FILTER_MODES> cascadeState;
+
+        // 1st-order DC blocker state - channels packed into aligned SIMD lanes
+        std::vector<DCFilterKernels::OnePoleLaneState<SampleType>> dcLaneState;
+        DCFilterKernels::OnePoleBlockCoefficients<SampleType> dcBlockCoefs; // For the time-parallel kernel
+        SampleType dcR{ SampleType(0.999) };                              // Coefficient: exp(-2π * fc / fs)
+
+        // Cutoff baked into modeCoefficients[MODE_2POLE_VARIABLE]
+        float variableCutoff{ CUTOFF_20HZ };
+
+        std::vector<SampleType*> transitionChannels; // Views into scratchArena
     };
 
-    // Processor chains for different filter types
-    juce::dsp::ProcessorChain<Filter> filterChain2Pole;    // For 2nd-order filters
-    juce::dsp::ProcessorChain<Filter> analysisFilterChain; // For low-frequency analysis
+    DSPState<float> floatState;
+    DSPState<double> doubleState;
+
+    template <typename SampleType>
+    DSPState<SampleType>& getDSPState()
+    {
+        if constexpr (std::is_same_v<SampleType, double>)
+            return doubleState;
+        else
+            return floatState;
+    }
+
+    int activeMode{ MODE_2POLE_20HZ }; // Audio thread only
 
-    // 1st-order DC blocker state (per channel) - CORRECTED: Persistent state
-    std::vector<float> dcXPrev;  // Previous input sample per channel
-    std::vector<float> dcYPrev;  // Previous output sample per channel
-    float dcR{ 0.999f };         // Coefficient: exp(-2π * fc / fs)
+    // Mode crossfade: the retiring path keeps running on a copy of the input
+    // and is faded out over transitionLength samples
+    int transitionFromMode{ MODE_BYPASS };
+    int transitionLength{ 0 };
+    int transitionSamplesRemaining{ 0 };
+    juce::AudioProcessLoadMeasurer transitionLoad; // Extra cost of crossfades
 
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
@@ -96,41 +199,174 @@ private:
     // Sample rate for filter calculations
     double currentSampleRate{ 44100.0 };
 
+    // Float SVF and metering kernels for this CPU (see DCFilterKernelsISA.h).
+    // The coefficients are built for their width, so a new choice waits in
+    // selectedKernelVariant until prepareToPlay
+    const DCFilterKernelsISA::KernelTable* isaKernels{ nullptr };
+    std::atomic<DCFilterKernelsISA::Variant> selectedKernelVariant{ DCFilterKernelsISA::Variant::sse2 };
+
+    // Audio-thread memory, all reserved in prepareToPlay. Blocks longer than
+    // preparedBlockSize are split so nothing sized from it can overflow
+    ScratchArena scratchArena;
+    int preparedBlockSize{ 0 };
+
+    // Cached so the audio thread never looks parameters up by name
+    std::atomic<float>* filterModeParameter{ nullptr };
+    std::atomic<float>* crossfadeParameter{ nullptr };
+    std::atomic<float>* cutoffParameter{ nullptr };
+    std::atomic<float>* meteringLevelParameter{ nullptr };
+
+    // Variable cutoff. Settled values are baked into the mode's coefficients
+    // (see DSPState::variableCutoff); sweeps in between run per sample
+    static constexpr double cutoffSmoothingSeconds = 0.05;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> cutoffSmoother;
+
+    // Mode automation. The listener queues every change; the audio thread
+    // applies it at the next automationGridSize boundary of the absolute
+    // timeline and splits the block there. Since the boundary does not depend
+    // on where the host's blocks start, renders are identical for any buffer
+    // size that divides the grid
+    static constexpr int automationGridSize = 4096;
+
+    struct ModeChangeEvent
+    {
+        int mode;
+    };
+
+    struct PendingModeChange
+    {
+        juce::int64 timelineSample;
+        int mode;
+    };
+
+    ParameterEventQueue<ModeChangeEvent, 64> modeChangeQueue;
+    std::array<PendingModeChange, 8> pendingModeChanges;
+    int numPendingModeChanges{ 0 };
+    int requestedMode{ MODE_2POLE_20HZ }; // Audio thread only
+    juce::int64 timelinePosition{ 0 };    // Expected start of the next block
+
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    juce::int64 getBlockTimelinePosition();
+    void collectModeChanges(juce::int64 blockStart);
+
     // Visualizer data - lock-free communication between audio and GUI threads
     std::atomic<bool> visualizerActive{ false };
-    float visualizerFifo[fifoSize];
-
-    // PRE-filter audio metrics (input signal)
-    std::atomic<float> dcOffsetPre{ 0.0f };
-    std::atomic<float> rmsPre{ 0.0f };
-    std::atomic<float> peakPre{ 0.0f };
-    std::atomic<float> lowFreqPre{ 0.0f };
-
-    // POST-filter audio metrics (output signal - what you actually hear)
-    std::atomic<float> dcOffsetPost{ 0.0f };
-    std::atomic<float> rmsPost{ 0.0f };
-    std::atomic<float> peakPost{ 0.0f };
-    std::atomic<float> lowFreqPost{ 0.0f };
-
-    // RMS calculation
-    float rmsSumPre{ 0.0f };
-    float rmsSumPost{ 0.0f };
-    float lowFreqSumPre{ 0.0f };
-    float lowFreqSumPost{ 0.0f };
-    int rmsSampleCount{ 0 };
-    const int rmsUpdateInterval = 256; // Update RMS every N samples
+    ScopeRing<scopeRingSize> scopeRing;
+    ScopePyramidType scopePyramid;
+
+    // Metering runs on the process-wide analysis pool. The audio thread
+    // copies each block's input and output into the analyzer's ring and
+    // does nothing else for it; at LEVEL_OFF it does not even copy
+    MeteringAnalyzer meteringAnalyzer;
+    std::atomic<int> metricsSubscribers{ 0 };
+    int meteringLevel{ Metering::LEVEL_OFF }; // Audio thread only: the level of the current block
+
+    void updateMeteringLevel(juce::int64 blockStart);
+
+    // LF analysis cutoff the meters use for a filter mode (audio thread):
+    // the variable mode's cutoff as currently smoothed, otherwise the mode's
+    // fixed corner. The cascade modes are 20 Hz filters as well
+    float getAnalysisCutoff(int mode) const
+    {
+        if (mode == MODE_2POLE_VARIABLE)
+            return cutoffSmoother.getCurrentValue();
+
+        return mode == MODE_2POLE_10HZ ? CUTOFF_10HZ : (mode == MODE_DC_1POLE ? CUTOFF_1POLE : CUTOFF_20HZ);
+    }
 
     // Filter coefficient functions
-    void updateFilterCoefficients();
-    void updateAnalysisFilterCoefficients();
+    template <typename SampleType>
+    void prepareDSPState(int numChannels);
+    template <typename SampleType>
+    void updateModeCoefficientTable();
+    template <typename SampleType>
     void updateOnePoleCoefficients();
+    template <typename SampleType>
+    void updateBlockCoefficients(ModeCoefficients<SampleType>& coefs);
+
+    // Section kernel: the ISA variant for float, the JUCE SIMD kernels for double
+    template <typename SampleType>
+    void processHighPassSection(SampleType* data, int numSamples, const ModeCoefficients<SampleType>& coefs,
+        DCFilterKernels::SVFState<SampleType>& state);
 
     // Filter processing functions - CORRECTED: 1st-order with persistent state
-    void processOnePoleDCBlocker(juce::AudioBuffer<float>& buffer);
+    template <int fixedChannels = 0, typename SampleType>
+    void processOnePoleDCBlocker(juce::dsp::AudioBlock<SampleType> block);
+    template <int fixedChannels = 0, typename SampleType>
+    void processHighPass(juce::dsp::AudioBlock<SampleType> block, int mode);
+    template <int fixedChannels = 0, typename SampleType>
+    void processVariableHighPass(juce::dsp::AudioBlock<SampleType> block);
+    template <int fixedChannels = 0, typename SampleType>
+    void processHighPassChannels(juce::dsp::AudioBlock<SampleType> block, const ModeCoefficients<SampleType>& coefs,
+        std::vector<DCFilterKernels::SVFState<SampleType>>& channels);
+    template <int fixedChannels = 0, typename SampleType>
+    void processCascade(juce::dsp::AudioBlock<SampleType> block, int mode);
+    template <typename SampleType>
+    void processModeFilter(juce::dsp::AudioBlock<SampleType> block, int mode);
+
+    // Click-free mode switching
+    template <typename SampleType>
+    void beginModeTransition(int newMode, juce::dsp::AudioBlock<SampleType> block);
+    template <typename SampleType>
+    void mixTransition(juce::dsp::AudioBlock<SampleType> chunk, juce::dsp::AudioBlock<SampleType> oldPath);
+
+    // Fused per-chunk kernel: input copy for metering, filter, output copy
+    // and visualizer feed in one traversal. Instantiated per mode, chosen
+    // once per block
+    static constexpr int fusedChunkSize = 256; // Samples; keeps a chunk in L1
+    template <int mode, int fixedChannels, typename SampleType>
+    void processFused(juce::dsp::AudioBlock<SampleType> block, juce::int64 timelineSample, bool feedVisualizer);
+
+    // Table of processFused instantiations by mode and channel class
+    // (fixedChannels 1, 2 or 0 = any), indexed once per mode switch
+    enum ChannelClass {
+        CHANNELS_MONO = 0,
+        CHANNELS_STEREO = 1,
+        CHANNELS_ANY = 2,
+        NUM_CHANNEL_CLASSES
+    };
 
-    // Separate functions for pre and post analysis
-    void updatePreFilterMetrics(const juce::AudioBuffer<float>& buffer);
-    void updatePostFilterMetrics(const juce::AudioBuffer<float>& buffer);
+    template <typename SampleType>
+    using KernelTable = std::array<std::array<FusedKernel<SampleType>, NUM_CHANNEL_CLASSES>, NUM_FILTER_MODES>;
+
+    template <typename SampleType, size_t... modes>
+    static constexpr KernelTable<SampleType> makeKernelTable(std::index_sequence<modes...>);
+    template <typename SampleType>
+    static const KernelTable<SampleType>& getKernelTable();
+    void selectKernels();
+
+    int channelClass{ CHANNELS_ANY };
+    int preparedNumChannels{ 0 };
+
+    // timelineSample: where the sub-block starts on the timeline, which
+    // stamps its metering record
+    template <typename SampleType>
+    void processSubBlock(juce::dsp::AudioBlock<SampleType> block, juce::int64 timelineSample);
+
+    // Silence fast path. Once the input is silent and the active mode's
+    // state has decayed below silenceThreshold, the output is silence too:
+    // the block is cleared and the filter and metering copies are skipped.
+    // The threshold is below half an LSB at 24 bits
+    static constexpr double silenceThreshold = 1.0 / (1 << 24);
+    template <typename SampleType>
+    static bool isSilent(juce::dsp::AudioBlock<SampleType> block);
+    template <typename SampleType>
+    bool isFilterStateDecayed(int mode);
+    template <typename SampleType>
+    void clearFilterState(int mode);
+    template <typename SampleType>
+    void processSilence(juce::dsp::AudioBlock<SampleType> block, juce::int64 timelineSample, bool feedVisualizer);
+
+    // Largest pole radius of a mode's filter (0 for bypass); the tail is
+    // how long it takes to decay to silenceThreshold
+    double getPoleRadius(int mode, double sampleRate) const;
+
+    // Shared body of both processBlock overloads
+    template <typename SampleType>
+    void processBuffer(juce::AudioBuffer<SampleType>& buffer);
+
+    template <typename SampleType>
+    void pushToVisualizer(const SampleType* data, int numSamples);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NewProjectAudioProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "ScopeRing.h"
+
+//==============================================================================
+// Min/max decimation pyramid for the scope. The audio thread folds the
+// samples it pushes into buckets of 4, 16, 64, ... samples, one level per
+// bucket size, and publishes each level's finished buckets through its own
+// ScopeRing. The reader draws a window of any length from the finest level
+// with at least one bucket per pixel column, so a column merges at most a
+// few buckets and the cost of a frame depends on the width only.
+//==============================================================================
+struct ScopeSpan
+{
+    float min, max;
+
+    static constexpr ScopeSpan empty() noexcept
+    {
+        return { std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest() };
+    }
+
+    void merge(ScopeSpan other) noexcept
+    {
+        min = juce::jmin(min, other.min);
+        max = juce::jmax(max, other.max);
+    }
+};
+
+// Merges numEntries spans (or raw samples) in time order into numColumns
+// columns. A column narrower than one entry takes the entry under it
+template <typename EntryType>
+inline void mergeIntoColumns(const EntryType* entries, int numEntries, ScopeSpan* columns, int numColumns) noexcept
+{
+    auto spanOf = [](EntryType entry)
+    {
+        if constexpr (std::is_same_v<EntryType, ScopeSpan>)
+            return entry;
+        else
+            return ScopeSpan{ static_cast<float>(entry), static_cast<float>(entry) };
+    };
+
+    for (int column = 0; column < numColumns; ++column)
+    {
+        auto begin = static_cast<int>(static_cast<juce::int64>(column) * numEntries / numColumns);
+        auto end = juce::jmax(begin + 1, static_cast<int>(static_cast<juce::int64>(column + 1) * numEntries / numColumns));
+
+        auto span = spanOf(entries[begin]);
+
+        for (int i = begin + 1; i < end; ++i)
+            span.merge(spanOf(entries[i]));
+
+        columns[column] = span;
+    }
+}
+
+template <int numLevels, int levelCapacity>
+class ScopePyramid
+{
+public:
+    // Each level's buckets cover this many of the level below
+    static constexpr int levelFactor = 4;
+
+    static constexpr int getBucketSize(int level) noexcept
+    {
+        int size = levelFactor;
+
+        for (int i = 0; i < level; ++i)
+            size *= levelFactor;
+
+        return size;
+    }
+
+    ScopePyramid() { reset(); }
+
+    // Not while either side is running
+    void reset() noexcept
+    {
+        for (int level = 0; level < numLevels; ++level)
+        {
+            levels[level].reset();
+            pending[level] = ScopeSpan::empty();
+            pendingCount[level] = 0;
+        }
+    }
+
+    // Audio thread only. Finished buckets are collected per slice and
+    // published with one release store per level
+    template <typename SampleType>
+    void push(const SampleType* data, int numSamples) noexcept
+    {
+        while (numSamples > 0)
+        {
+            const int sliceSize = juce::jmin(numSamples, batchSize * levelFactor);
+            int finished[numLevels] = {};
+
+            for (int i = 0; i < sliceSize;)
+            {
+                // Rest of the current first-level bucket
+                const int run = juce::jmin(sliceSize - i, levelFactor - pendingCount[0]);
+                auto span = pending[0];
+
+                for (int k = 0; k < run; ++k)
+                {
+                    const auto x = static_cast<float>(data[i + k]);
+                    span.min = juce::jmin(span.min, x);
+                    span.max = juce::jmax(span.max, x);
+                }
+
+                pending[0] = span;
+                pendingCount[0] += run;
+                i += run;
+
+                if (pendingCount[0] == levelFactor)
+                    finishBucket(0, finished);
+            }
+
+            for (int level = 0; level < numLevels; ++level)
+                if (finished[level] > 0)
+                    levels[level].push(batch[level], finished[level]);
+
+            data += sliceSize;
+            numSamples -= sliceSize;
+        }
+    }
+
+    // Reader only. Fills numColumns spans covering the latest windowSamples
+    // samples, up to the last finished bucket of the level used. scratch
+    // holds levelCapacity spans. Returns false when the window has less
+    // than a first-level bucket per column (draw raw samples instead), is
+    // longer than any level holds, or the writer overtook the copy
+    bool readColumns(double windowSamples, ScopeSpan* columns, int numColumns, ScopeSpan* scratch) const noexcept
+    {
+        const int level = findLevel(windowSamples / numColumns, windowSamples);
+
+        if (level < 0)
+            return false;
+
+        const auto numBuckets = static_cast<int>(std::ceil(windowSamples / getBucketSize(level)));
+        const auto& ring = levels[level];
+
+        if (! ring.read(ring.getWritePosition(), scratch, numBuckets))
+            return false;
+
+        mergeIntoColumns(scratch, numBuckets, columns, numColumns);
+        return true;
+    }
+
+    // Finest level with a bucket no longer than samplesPerColumn that still
+    // holds windowSamples, or -1 if there is none (draw raw samples)
+    static int findLevel(double samplesPerColumn, double windowSamples) noexcept
+    {
+        for (int level = 0; level < numLevels && getBucketSize(level) <= samplesPerColumn; ++level)
+            if (windowSamples <= static_cast<double>(getBucketSize(level)) * levelCapacity)
+                return level;
+
+        return -1;
+    }
+
+    // Samples covered by the finished buckets of a level
+    juce::uint64 getSamplesAvailable(int level) const noexcept
+    {
+        return levels[level].getWritePosition() * static_cast<juce::uint64>(getBucketSize(level));
+    }
+
+    // Reader only. Fills numColumns spans of samplesPerColumn samples each,
+    // the last ending at endSample (at most getSamplesAvailable(level)).
+    // Columns sit at fixed sample positions, so the same column reads the
+    // same span on every call; columns before the first sample are silent.
+    // Returns false if the span is longer than the level holds or the
+    // writer overtook the copy
+    bool readAlignedColumns(int level, juce::uint64 endSample, int samplesPerColumn,
+                            ScopeSpan* columns, int numColumns, ScopeSpan* scratch) const noexcept
+    {
+        const auto bucketSize = static_cast<juce::int64>(getBucketSize(level));
+        const auto end = static_cast<juce::int64>(endSample);
+        const auto start = end - static_cast<juce::int64>(samplesPerColumn) * numColumns;
+
+        const auto firstBucket = juce::jmax(static_cast<juce::int64>(0), start) / bucketSize;
+        const auto endBucket = (end + bucketSize - 1) / bucketSize;
+        const auto numBuckets = static_cast<int>(endBucket - firstBucket);
+
+        if (numBuckets > levelCapacity)
+            return false;
+
+        if (numBuckets > 0 && ! levels[level].read(static_cast<juce::uint64>(endBucket), scratch, numBuckets))
+            return false;
+
+        for (int column = 0; column < numColumns; ++column)
+        {
+            const auto columnStart = start + static_cast<juce::int64>(column) * samplesPerColumn;
+            const auto columnEnd = columnStart + samplesPerColumn;
+
+            if (columnEnd <= 0)
+            {
+                columns[column] = {};
+                continue;
+            }
+
+            const auto begin = static_cast<int>(juce::jmax(static_cast<juce::int64>(0), columnStart) / bucketSize - firstBucket);
+            const auto last = static_cast<int>((columnEnd + bucketSize - 1) / bucketSize - firstBucket);
+            auto span = scratch[begin];
+
+            for (int i = begin + 1; i < last; ++i)
+                span.merge(scratch[i]);
+
+            columns[column] = span;
+        }
+
+        return true;
+    }
+
+private:
+    // First-level buckets collected per slice before publishing
+    static constexpr int batchSize = 64;
+
+    void finishBucket(int level, int* finished) noexcept
+    {
+        batch[level][finished[level]++] = pending[level];
+
+        if (level + 1 < numLevels)
+        {
+            pending[level + 1].merge(pending[level]);
+
+            if (++pendingCount[level + 1] == levelFactor)
+                finishBucket(level + 1, finished);
+        }
+
+        pending[level] = ScopeSpan::empty();
+        pendingCount[level] = 0;
+    }
+
+    ScopeRing<levelCapacity, ScopeSpan> levels[numLevels];
+
+    // Writer's: the bucket being filled on each level, and this slice's
+    // finished buckets
+    ScopeSpan pending[numLevels];
+    int pendingCount[numLevels];
+    ScopeSpan batch[numLevels][batchSize];
+
+    JUCE_DECLARE_NON_COPYABLE(ScopePyramid)
+};
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Single-producer / single-consumer sample ring for the scope. Elements are
+// floats by default; ScopePyramid keeps its min/max pairs in the same ring.
+// The audio thread copies a whole block in and publishes it with one release
+// store of a 64-bit sample counter, which does not wrap in any realistic
+// uptime. The writer never waits: old samples are overwritten.
+//
+// Overwrites are detected as in a seqlock. Before touching any slot the
+// writer announces the position it is about to write up to, and the reader
+// checks that announcement after copying: if the writer may have reached the
+// span, the copy is discarded. The elements themselves are atomics accessed
+// with relaxed loads and stores, so a copy that races the writer is merely
+// stale, never undefined, and on the targets this builds for they compile to
+// plain moves.
+//==============================================================================
+template <int capacity, typename ElementType = float>
+class ScopeRing
+{
+public:
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::atomic<ElementType>::is_always_lock_free, "Elements must be lock-free atomics");
+
+    ScopeRing() { reset(); }
+
+    // Not while either side is running
+    void reset() noexcept
+    {
+        for (auto& sample : samples)
+            sample.store(ElementType{}, std::memory_order_relaxed);
+
+        writePosition.store(0, std::memory_order_relaxed);
+        claimedPosition.store(0, std::memory_order_relaxed);
+    }
+
+    // Audio thread only
+    template <typename SampleType>
+    void push(const SampleType* data, int numSamples) noexcept
+    {
+        if (numSamples > capacity)
+        {
+            data += numSamples - capacity;
+            numSamples = capacity;
+        }
+
+        auto position = writePosition.load(std::memory_order_relaxed);
+        auto start = static_cast<int>(position & mask);
+        auto firstPart = juce::jmin(numSamples, capacity - start);
+
+        // Announce the overwrite before any slot changes: a reader that sees
+        // one of the new elements also sees this
+        claimedPosition.store(position + static_cast<juce::uint64>(numSamples), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (int i = 0; i < firstPart; ++i)
+            samples[start + i].store(static_cast<ElementType>(data[i]), std::memory_order_relaxed);
+
+        for (int i = firstPart; i < numSamples; ++i)
+            samples[i - firstPart].store(static_cast<ElementType>(data[i]), std::memory_order_relaxed);
+
+        writePosition.store(position + static_cast<juce::uint64>(numSamples), std::memory_order_release);
+    }
+
+    // Total samples pushed since reset
+    juce::uint64 getWritePosition() const noexcept { return writePosition.load(std::memory_order_acquire); }
+
+    // Reader only. Copies the numSamples samples ending at endPosition (at
+    // most capacity, and not past getWritePosition()) into dest. Returns
+    // false if the writer overwrote part of the span during the copy
+    bool read(juce::uint64 endPosition, ElementType* dest, int numSamples) const noexcept
+    {
+        jassert(numSamples <= capacity);
+
+        // Silence before the first sample pushed
+        if (endPosition < static_cast<juce::uint64>(numSamples))
+        {
+            auto missing = numSamples - static_cast<int>(endPosition);
+            std::fill(dest, dest + missing, ElementType{});
+            dest += missing;
+            numSamples -= missing;
+        }
+
+        auto startPosition = endPosition - static_cast<juce::uint64>(numSamples);
+        auto start = static_cast<int>(startPosition & mask);
+        auto firstPart = juce::jmin(numSamples, capacity - start);
+
+        for (int i = 0; i < firstPart; ++i)
+            dest[i] = samples[start + i].load(std::memory_order_relaxed);
+
+        for (int i = firstPart; i < numSamples; ++i)
+            dest[i] = samples[i - firstPart].load(std::memory_order_relaxed);
+
+        // Anything claimed since endPosition, published or still being
+        // written, may have reused the span's slots
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto claimed = claimedPosition.load(std::memory_order_relaxed);
+        return claimed - startPosition <= static_cast<juce::uint64>(capacity);
+    }
+
+private:
+    static constexpr juce::uint64 mask = static_cast<juce::uint64>(capacity - 1);
+
+    std::atomic<ElementType> samples[capacity];
+    alignas(64) std::atomic<juce::uint64> writePosition{ 0 };   // End of the published samples
+    std::atomic<juce::uint64> claimedPosition{ 0 };             // End of the samples being written
+
+    JUCE_DECLARE_NON_COPYABLE(ScopeRing)
+};
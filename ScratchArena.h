@@ -0,0 +1,83 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Scratch memory for the audio thread. All storage is reserved up front in
+// prepareToPlay; allocate() only bumps an offset and reset() hands the whole
+// arena back at the start of each block, so the audio thread never touches
+// the system allocator.
+//==============================================================================
+class ScratchArena
+{
+public:
+    ScratchArena() = default;
+
+    // Message thread only (prepareToPlay)
+    template <typename SampleType = float>
+    void prepare(size_t numSamples)
+    {
+        capacity = roundUp(numSamples * sizeof(SampleType));
+        storage.allocate(capacity + alignment, true);
+        used = 0;
+    }
+
+    void reset() noexcept { used = 0; }
+
+    // Hands back everything allocated during its lifetime, so per-chunk
+    // scratch can be taken again by the next chunk of the same block
+    class ScopedMark
+    {
+    public:
+        explicit ScopedMark(ScratchArena& a) noexcept : arena(a), mark(a.used) {}
+        ~ScopedMark() { arena.used = mark; }
+
+    private:
+        ScratchArena& arena;
+        size_t mark;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedMark)
+    };
+
+    // Returns storage aligned for any SIMD width, or nullptr if the request
+    // does not fit in what prepare() reserved
+    template <typename SampleType = float>
+    SampleType* allocate(size_t numSamples) noexcept
+    {
+        auto size = roundUp(numSamples * sizeof(SampleType));
+
+        if (used + size > capacity)
+        {
+            jassertfalse; // Reserve more in prepareToPlay
+            return nullptr;
+        }
+
+        auto* result = getAlignedBase() + used;
+        used += size;
+        return reinterpret_cast<SampleType*>(result);
+    }
+
+    // In bytes
+    size_t getCapacity() const noexcept { return capacity; }
+
+private:
+    // 64 bytes: a cache line, and wide enough for every SIMD register size
+    static constexpr size_t alignment = 64;
+
+    static size_t roundUp(size_t numBytes) noexcept
+    {
+        return (numBytes + alignment - 1) / alignment * alignment;
+    }
+
+    char* getAlignedBase() const noexcept
+    {
+        auto address = reinterpret_cast<uintptr_t>(storage.get());
+        return reinterpret_cast<char*>((address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+    }
+
+    juce::HeapBlock<char> storage;
+    size_t capacity{ 0 };
+    size_t used{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE(ScratchArena)
+};
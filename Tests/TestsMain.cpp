@@ -0,0 +1,21 @@
+#include <JuceHeader.h>
+
+//==============================================================================
+// Console runner for the plugin's unit tests. DCHighpassTests.jucer builds
+// the plugin sources into this app with JUCE_UNIT_TESTS=1; the exit code is
+// non-zero if any test failed, so a build script can gate on it.
+//==============================================================================
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+    runner.runTestsInCategory("DCHighpass");
+
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        if (runner.getResult(i)->failures > 0)
+            return 1;
+
+    return 0;
+}
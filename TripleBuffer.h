@@ -0,0 +1,57 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Wait-free single-writer / single-reader triple buffer. The writer fills the
+// back buffer and publishes it by swapping it with the middle one; the reader
+// swaps the middle one to the front when something new has arrived. Neither
+// side waits or retries, and the reader always holds one whole publication.
+//==============================================================================
+template <typename ValueType>
+class TripleBuffer
+{
+public:
+    TripleBuffer() = default;
+
+    // Writer only. Holds whatever was published two swaps ago, so the writer
+    // fills it completely before each publish()
+    ValueType& getWriteBuffer() noexcept { return slots[backIndex].value; }
+
+    // Writer only
+    void publish() noexcept
+    {
+        auto previous = middle.exchange(static_cast<uint8_t>(backIndex | newDataFlag), std::memory_order_acq_rel);
+        backIndex = static_cast<uint8_t>(previous & indexMask);
+    }
+
+    // Reader only. Takes the latest publication, if there is one, and
+    // returns it; the reference stays valid until the next read()
+    const ValueType& read() noexcept
+    {
+        if ((middle.load(std::memory_order_relaxed) & newDataFlag) != 0)
+        {
+            auto previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+            frontIndex = static_cast<uint8_t>(previous & indexMask);
+        }
+
+        return slots[frontIndex].value;
+    }
+
+private:
+    static constexpr uint8_t indexMask = 3;
+    static constexpr uint8_t newDataFlag = 4;
+
+    // Each buffer on its own cache lines, so the two sides never share one
+    struct alignas(64) Slot
+    {
+        ValueType value{};
+    };
+
+    Slot slots[3];
+    alignas(64) std::atomic<uint8_t> middle{ 1 };
+    alignas(64) uint8_t backIndex{ 0 };  // Writer's
+    alignas(64) uint8_t frontIndex{ 2 }; // Reader's
+
+    JUCE_DECLARE_NON_COPYABLE(TripleBuffer)
+};